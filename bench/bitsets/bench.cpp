@@ -0,0 +1,113 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_rand>
+#include <skl_dynamic_bitset>
+#include <skl_static_bitset>
+#include <skl_simd>
+
+namespace {
+constexpr u32 CBitsCount   = 65536U;
+constexpr u32 CIndexCount  = 4096U;
+constexpr u32 CIndexMask   = CIndexCount - 1U;
+
+//! Random bit indices, precomputed so the rng is not measured
+u32 g_indices[CIndexCount];
+
+//! Raw words for the simd kernels scan
+constexpr u32 CWordsCount = CBitsCount / 64U;
+alignas(64) u64 g_words[CWordsCount];
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::SklRand rand{};
+    for (auto& index : g_indices) {
+        index = rand.next_range(0U, CBitsCount - 1U);
+    }
+
+    skl::bench::BenchRunner runner{"bitsets", argc, argv};
+
+    {
+        skl::DynamicBitSet<false> bitset{CBitsCount};
+
+        runner.run("DynamicBitSet/set_unset_random", [&bitset](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                const u32 index = g_indices[i & CIndexMask];
+                (void)bitset.set(index);
+                (void)bitset.unset(index);
+            }
+            skl::bench::clobber_memory();
+        });
+
+        for (u32 i = 0U; i < CIndexCount; i += 2U) {
+            (void)bitset.set(g_indices[i]);
+        }
+        runner.run("DynamicBitSet/test_random", [&bitset](u64 f_iterations) noexcept {
+            u64 count = 0U;
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                count += bitset.test(g_indices[i & CIndexMask]) ? 1U : 0U;
+            }
+            skl::bench::do_not_optimize(count);
+        });
+
+        //Worst case scan, only the last bit is set
+        bitset.set_all_to(false);
+        (void)bitset.set(CBitsCount - 1U);
+        runner.run("DynamicBitSet/find_first_64k_last", [&bitset](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                skl::bench::do_not_optimize(bitset);
+                skl::bench::do_not_optimize(bitset.find_first<true>().value());
+            }
+        });
+
+        //Same scan with every kernel supported by the host
+        g_words[CWordsCount - 1U] = 1U;
+        const auto scan_kernel = [&runner](const char* f_name, skl::simd::ESimdLevel f_level, auto f_kernel) noexcept {
+            if (skl::simd::cpu_simd_level() < f_level) {
+                return;
+            }
+            runner.run(f_name, [f_kernel](u64 f_iterations) noexcept {
+                for (u64 i = 0U; i < f_iterations; ++i) {
+                    skl::bench::do_not_optimize(g_words);
+                    skl::bench::do_not_optimize(f_kernel(g_words, CWordsCount, 0U));
+                }
+            });
+        };
+        scan_kernel("simd/find_first_not_equal_64k_scalar", skl::simd::ESimdLevel::Scalar, [](const u64* f_words, u32 f_count, u64 f_value) noexcept {
+            return skl::simd::detail::find_first_not_equal_u64_scalar(f_words, f_count, f_value);
+        });
+#if defined(__x86_64__)
+        scan_kernel("simd/find_first_not_equal_64k_sse2", skl::simd::ESimdLevel::SSE2, &skl::simd::detail::find_first_not_equal_u64_sse2);
+        scan_kernel("simd/find_first_not_equal_64k_avx2", skl::simd::ESimdLevel::AVX2, &skl::simd::detail::find_first_not_equal_u64_avx2);
+        scan_kernel("simd/find_first_not_equal_64k_avx512", skl::simd::ESimdLevel::AVX512, &skl::simd::detail::find_first_not_equal_u64_avx512);
+#endif
+    }
+
+    {
+        static skl::StaticBitSet<CBitsCount> bitset{};
+
+        runner.run("StaticBitSet/set_unset_random", [](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                const u32 index = g_indices[i & CIndexMask];
+                (void)bitset.set(index);
+                (void)bitset.unset(index);
+            }
+            skl::bench::clobber_memory();
+        });
+
+        (void)bitset.set(CBitsCount - 1U);
+        runner.run("StaticBitSet/find_first_64k_last", [](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                skl::bench::do_not_optimize(bitset);
+                skl::bench::do_not_optimize(bitset.find_first<true>().value());
+            }
+        });
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,253 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_pool/buffer_pool>
+#include <skl_pool/hugepage_buffer_pool>
+#include <skl_rand>
+
+#include <memory>
+#include <cstring>
+#include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#if defined(SKL_CORE_USE_MIMALLOC)
+#    include <mimalloc.h>
+#endif
+
+namespace {
+constexpr u32 CBatchSize = 64U;
+
+//! Working set for the touch benchmarks (4096 x 16KB = 64MB, well past the L1/L2 dTLB reach with 4KB pages)
+constexpr u32 CWorkingSetBuffers = 4096U;
+constexpr u32 CWorkingSetSize    = 16384U;
+constexpr u32 CTouchIndexCount   = 65536U;
+
+//! Multi thread mixed size alloc/free
+constexpr u32 CThreadsCount = 4U;
+constexpr u32 CMixedBatch   = 256U;
+constexpr u32 CMixedSizes[] = {32U, 64U, 128U, 256U, 512U, 1024U};
+
+//! Allocate and free one buffer of f_size per iteration
+template <typename _Pool>
+void alloc_free_single(u64 f_iterations, u32 f_size) noexcept {
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        auto buffer = _Pool::buffer_alloc(f_size);
+        skl::bench::do_not_optimize(buffer.buffer);
+        if constexpr (__is_same(_Pool, skl::BufferPool)) {
+            _Pool::buffer_free(buffer.buffer);
+        } else {
+            _Pool::buffer_free(buffer);
+        }
+    }
+}
+
+//! Allocate CBatchSize buffers of f_size then free them (LIFO) per iteration
+template <typename _Pool>
+void alloc_free_batch(u64 f_iterations, u32 f_size) noexcept {
+    typename _Pool::buffer_t buffers[CBatchSize];
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        for (u32 j = 0U; j < CBatchSize; ++j) {
+            buffers[j] = _Pool::buffer_alloc(f_size);
+        }
+        skl::bench::clobber_memory();
+        for (u32 j = CBatchSize; j > 0U; --j) {
+            if constexpr (__is_same(_Pool, skl::BufferPool)) {
+                _Pool::buffer_free(buffers[j - 1U].buffer);
+            } else {
+                _Pool::buffer_free(buffers[j - 1U]);
+            }
+        }
+    }
+}
+//! Touch random cache lines of a large working set allocated from the pool (dominated by cache and dTLB misses)
+template <typename _Pool>
+void touch_working_set(skl::bench::BenchRunner& f_runner, const char* f_name, const u32* f_offsets) noexcept {
+    auto buffers = std::make_unique<typename _Pool::buffer_t[]>(CWorkingSetBuffers);
+    for (u32 i = 0U; i < CWorkingSetBuffers; ++i) {
+        buffers[i] = _Pool::buffer_alloc(CWorkingSetSize);
+        if (nullptr == buffers[i].buffer) {
+            (void)fprintf(stderr, "%s: failed to allocate the working set!\n", f_name);
+            return;
+        }
+        (void)memset(buffers[i].buffer, 0, CWorkingSetSize);
+    }
+
+    f_runner.run(f_name, [&buffers, f_offsets](u64 f_iterations) noexcept {
+        u64 sum = 0U;
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            const u32 offset = f_offsets[i & (CTouchIndexCount - 1U)];
+            auto&     buffer = buffers[offset / CWorkingSetSize];
+            sum += buffer.buffer[offset % CWorkingSetSize];
+            ++buffer.buffer[offset % CWorkingSetSize];
+        }
+        skl::bench::do_not_optimize(sum);
+    });
+
+    for (u32 i = 0U; i < CWorkingSetBuffers; ++i) {
+        if constexpr (__is_same(_Pool, skl::BufferPool)) {
+            _Pool::buffer_free(buffers[i].buffer);
+        } else {
+            _Pool::buffer_free(buffers[i]);
+        }
+    }
+}
+
+//! CThreadsCount threads kept alive across the repetitions (the thread start and the per thread pool caches are not measured)
+//! \remark Each run() round allocates CMixedBatch mixed size buffers on every thread then frees them
+//! \remark With f_cross_thread every 2nd buffer is handed to the next thread, which frees it once all threads finished allocating
+class mixed_alloc_free_threads_t {
+public:
+    using alloc_fn_t = void* (*)(u32 f_size) noexcept;
+    using free_fn_t  = void (*)(void* f_ptr) noexcept;
+
+    SKL_NO_MOVE_OR_COPY(mixed_alloc_free_threads_t);
+
+    mixed_alloc_free_threads_t(alloc_fn_t f_alloc, free_fn_t f_free, bool f_cross_thread) noexcept
+        : m_alloc(f_alloc)
+        , m_free(f_free)
+        , m_cross_thread(f_cross_thread) {
+        for (u32 t = 0U; t < CThreadsCount; ++t) {
+            m_threads.emplace_back([this, t]() noexcept { worker_main(t); });
+        }
+    }
+
+    ~mixed_alloc_free_threads_t() noexcept {
+        m_stop.store(true);
+        (void)m_generation.fetch_add(1U);
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    //! Run f_iterations rounds on every thread and wait for them
+    void run(u64 f_iterations) noexcept {
+        m_iterations           = f_iterations;
+        const u32 generation   = m_generation.fetch_add(1U) + 1U;
+        const u64 target_count = u64(generation) * CThreadsCount;
+        while (m_done.load() != target_count) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    void worker_main(u32 f_index) noexcept {
+        (void)skl::skl_core_init_thread();
+
+        void* local[CMixedBatch];
+        auto& outgoing = m_handoff[f_index];
+        u32   seen     = 0U;
+        for (;;) {
+            while (seen == m_generation.load()) {
+                std::this_thread::yield();
+            }
+            ++seen;
+            if (m_stop.load()) {
+                break;
+            }
+
+            const u64 iterations = m_iterations;
+            outgoing.clear();
+            for (u64 round = 0U; round < iterations; ++round) {
+                for (u32 i = 0U; i < CMixedBatch; ++i) {
+                    local[i] = m_alloc(CMixedSizes[(i + round) % std::size(CMixedSizes)]);
+                }
+                skl::bench::clobber_memory();
+                for (u32 i = 0U; i < CMixedBatch; ++i) {
+                    if (m_cross_thread && (0U == (i & 1U))) {
+                        outgoing.push_back(local[i]);
+                    } else {
+                        m_free(local[i]);
+                    }
+                }
+            }
+
+            //Free the buffers allocated by the previous thread
+            const u64 target_count = u64(seen) * CThreadsCount;
+            (void)m_allocated.fetch_add(1U);
+            while (m_allocated.load() < target_count) {
+                std::this_thread::yield();
+            }
+            for (void* ptr : m_handoff[(f_index + CThreadsCount - 1U) % CThreadsCount]) {
+                m_free(ptr);
+            }
+
+            (void)m_done.fetch_add(1U);
+        }
+
+        (void)skl::skl_core_deinit_thread();
+    }
+
+    alloc_fn_t               m_alloc;
+    free_fn_t                m_free;
+    bool                     m_cross_thread;
+    u64                      m_iterations{0U};   //!< Rounds of the current run (published by m_generation)
+    std::atomic<u32>         m_generation{0U};   //!< Bumped for each run()
+    std::atomic<u64>         m_allocated{0U};    //!< Threads done allocating (all runs)
+    std::atomic<u64>         m_done{0U};         //!< Threads done with the run (all runs)
+    std::atomic<bool>        m_stop{false};
+    std::vector<void*>       m_handoff[CThreadsCount];
+    std::vector<std::thread> m_threads;
+};
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"buffer-pool", argc, argv};
+
+    runner.run("BufferPool/alloc_free/64", [](u64 f_iterations) noexcept { alloc_free_single<skl::BufferPool>(f_iterations, 64U); });
+    runner.run("BufferPool/alloc_free/1024", [](u64 f_iterations) noexcept { alloc_free_single<skl::BufferPool>(f_iterations, 1024U); });
+    runner.run("BufferPool/alloc_free/16384", [](u64 f_iterations) noexcept { alloc_free_single<skl::BufferPool>(f_iterations, 16384U); });
+    runner.run("BufferPool/alloc_free_batch64/256", [](u64 f_iterations) noexcept { alloc_free_batch<skl::BufferPool>(f_iterations, 256U); }, CBatchSize);
+
+    runner.run("HugePageBufferPool/alloc_free/64", [](u64 f_iterations) noexcept { alloc_free_single<skl::HugePageBufferPool>(f_iterations, 64U); });
+    runner.run("HugePageBufferPool/alloc_free/1024", [](u64 f_iterations) noexcept { alloc_free_single<skl::HugePageBufferPool>(f_iterations, 1024U); });
+    runner.run("HugePageBufferPool/alloc_free/16384", [](u64 f_iterations) noexcept { alloc_free_single<skl::HugePageBufferPool>(f_iterations, 16384U); });
+    runner.run("HugePageBufferPool/alloc_free_batch64/256", [](u64 f_iterations) noexcept { alloc_free_batch<skl::HugePageBufferPool>(f_iterations, 256U); }, CBatchSize);
+
+    {
+        auto pool_alloc = [](u32 f_size) noexcept -> void* { return skl::BufferPool::buffer_alloc(f_size).buffer; };
+        auto pool_free  = [](void* f_ptr) noexcept { skl::BufferPool::buffer_free(f_ptr); };
+#if defined(SKL_CORE_USE_MIMALLOC)
+        auto ref_alloc = [](u32 f_size) noexcept -> void* { return mi_malloc(f_size); };
+        auto ref_free  = [](void* f_ptr) noexcept { mi_free(f_ptr); };
+#    define SKL_BENCH_REF_ALLOCATOR "mimalloc"
+#else
+        auto ref_alloc = [](u32 f_size) noexcept -> void* { return std::malloc(f_size); };
+        auto ref_free  = [](void* f_ptr) noexcept { std::free(f_ptr); };
+#    define SKL_BENCH_REF_ALLOCATOR "malloc"
+#endif
+
+        auto run_mixed = [&runner](const char* f_name, mixed_alloc_free_threads_t::alloc_fn_t f_alloc, mixed_alloc_free_threads_t::free_fn_t f_free, bool f_cross_thread) noexcept {
+            mixed_alloc_free_threads_t threads{f_alloc, f_free, f_cross_thread};
+
+            //Populate the allocator before the calibration (a cold first run would pin the iterations count to 1)
+            threads.run(64U);
+            runner.run(f_name, [&threads](u64 f_iterations) noexcept { threads.run(f_iterations); }, u64(CThreadsCount) * CMixedBatch);
+        };
+
+        run_mixed("BufferPool/alloc_free_mixed/threads:4", pool_alloc, pool_free, false);
+        run_mixed(SKL_BENCH_REF_ALLOCATOR "/alloc_free_mixed/threads:4", ref_alloc, ref_free, false);
+        run_mixed("BufferPool/alloc_free_mixed_cross_thread/threads:4", pool_alloc, pool_free, true);
+        run_mixed(SKL_BENCH_REF_ALLOCATOR "/alloc_free_mixed_cross_thread/threads:4", ref_alloc, ref_free, true);
+
+#undef SKL_BENCH_REF_ALLOCATOR
+    }
+
+    //Same random cache lines for both pools
+    auto         offsets = std::make_unique<u32[]>(CTouchIndexCount);
+    skl::SklRand rand{};
+    for (u32 i = 0U; i < CTouchIndexCount; ++i) {
+        offsets[i] = rand.next_range(0U, (CWorkingSetBuffers * CWorkingSetSize) - 1U) & ~(SKL_CACHE_LINE_SIZE - 1U);
+    }
+
+    touch_working_set<skl::BufferPool>(runner, "BufferPool/touch_random_64MB", offsets.get());
+    touch_working_set<skl::HugePageBufferPool>(runner, "HugePageBufferPool/touch_random_64MB", offsets.get());
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,85 @@
+#
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Balan Narcis (balannarcis96@gmail.com)
+#
+# Compare two skl-core benchmark json results (see bench/include/skl_bench)
+#
+#   python3 bench/compare.py <baseline.json|dir> <candidate.json|dir> [--metric p50_ns] [--threshold 5]
+#
+# Directories are matched file by file (as written by the skl-core-run-benchmarks target).
+# Exits with 1 if any benchmark regressed by more than --threshold percent.
+#
+import argparse
+import json
+import os
+import sys
+from typing import Dict, List, Optional, Tuple
+
+
+def load_results(path: str) -> Dict[str, Dict[str, dict]]:
+    """Load {suite: {benchmark name: result}} from a json file or a directory of json files."""
+    files: List[str] = []
+    if os.path.isdir(path):
+        files = sorted(os.path.join(path, name) for name in os.listdir(path) if name.endswith(".json"))
+    else:
+        files = [path]
+
+    suites: Dict[str, Dict[str, dict]] = {}
+    for file in files:
+        with open(file, "r") as handle:
+            data = json.load(handle)
+        suites[data["suite"]] = {entry["name"]: entry for entry in data["benchmarks"]}
+    return suites
+
+
+def metric_value(entry: dict, metric: str) -> Optional[float]:
+    """Get the metric value of a benchmark entry, counters are addressed as counters.<name>."""
+    if metric.startswith("counters."):
+        value = entry.get("counters", {}).get(metric[len("counters."):])
+    else:
+        value = entry.get(metric)
+    return None if value is None else float(value)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Compare skl-core benchmark results")
+    parser.add_argument("baseline", help="Baseline json file or directory")
+    parser.add_argument("candidate", help="Candidate json file or directory")
+    parser.add_argument("--metric", default="p50_ns",
+                        help="Metric to compare (min_ns, p50_ns, p90_ns, p99_ns, mean_ns or a counter eg. counters.dtlb_misses)")
+    parser.add_argument("--threshold", type=float, default=5.0, help="Regression threshold in percent")
+    args = parser.parse_args()
+
+    baseline = load_results(args.baseline)
+    candidate = load_results(args.candidate)
+
+    rows: List[Tuple[str, float, float, float]] = []
+    for suite, benchmarks in candidate.items():
+        for name, entry in benchmarks.items():
+            base_entry = baseline.get(suite, {}).get(name)
+            if base_entry is None:
+                print(f"[new] {suite}/{name}")
+                continue
+            old = metric_value(base_entry, args.metric)
+            new = metric_value(entry, args.metric)
+            if old is None or new is None:
+                continue
+            delta = ((new - old) / old * 100.0) if old > 0.0 else 0.0
+            rows.append((name, old, new, delta))
+
+    regressions = 0
+    print(f"{'benchmark':<56} {'old ' + args.metric:>14} {'new ' + args.metric:>14} {'delta':>9}")
+    for name, old, new, delta in rows:
+        marker = ""
+        if delta > args.threshold:
+            marker = "  <-- regression"
+            regressions += 1
+        elif delta < -args.threshold:
+            marker = "  <-- improvement"
+        print(f"{name:<56} {old:>14.2f} {new:>14.2f} {delta:>8.1f}%{marker}")
+
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,106 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_vector>
+#include <skl_fixed_vector>
+#include <skl_circular_queue_if>
+#include <skl_deck>
+
+namespace {
+constexpr u64 CElementsCount = 1024U;
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"containers", argc, argv};
+
+    {
+        skl::skl_vector<u64> vector{};
+        auto&                vector_if = vector.upgrade();
+        vector_if.reserve(CElementsCount);
+
+        runner.run("skl_vector/push_back_1024_clear", [&vector_if](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (u64 j = 0U; j < CElementsCount; ++j) {
+                    vector_if.push_back(j);
+                }
+                skl::bench::do_not_optimize(vector_if.back());
+                vector_if.clear();
+            }
+        }, CElementsCount);
+
+        for (u64 j = 0U; j < CElementsCount; ++j) {
+            vector_if.push_back(j);
+        }
+        runner.run("skl_vector/iterate_sum_1024", [&vector](u64 f_iterations) noexcept {
+            u64 sum = 0U;
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (const u64 value : vector) {
+                    sum += value;
+                }
+                skl::bench::do_not_optimize(sum);
+            }
+        }, CElementsCount);
+    }
+
+    {
+        skl::skl_fixed_vector<u64, CElementsCount> vector{};
+        runner.run("skl_fixed_vector/push_back_1024_clear", [&vector](u64 f_iterations) noexcept {
+            auto& vector_if = vector.upgrade();
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (u64 j = 0U; j < CElementsCount; ++j) {
+                    vector_if.push_back(j);
+                }
+                skl::bench::do_not_optimize(vector_if.back());
+                vector_if.clear();
+            }
+        }, CElementsCount);
+    }
+
+    {
+        skl::skl_circular_queue<u64, CElementsCount> queue{};
+        runner.run("skl_circular_queue/push_pop_1024", [&queue](u64 f_iterations) noexcept {
+            auto& queue_if = queue.upgrade();
+            u64   sum      = 0U;
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (u64 j = 0U; j < CElementsCount; ++j) {
+                    queue_if.push(j);
+                }
+                while (false == queue_if.empty()) {
+                    sum += queue_if.tail();
+                    queue_if.pop();
+                }
+                skl::bench::do_not_optimize(sum);
+            }
+        }, CElementsCount);
+    }
+
+    {
+        skl::Deck<u64> deck{};
+        runner.run("Deck/add_1024_clear", [&deck](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (u64 j = 0U; j < CElementsCount; ++j) {
+                    skl::bench::do_not_optimize(deck.add(j).item);
+                }
+                deck.clear();
+            }
+        }, CElementsCount);
+
+        for (u64 j = 0U; j < CElementsCount; ++j) {
+            (void)deck.add(j);
+        }
+        static u64 g_sum = 0U;
+        runner.run("Deck/for_each_1024", [&deck](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                deck.for_each<decltype([](u64& f_value) static noexcept { g_sum += f_value; })>();
+                skl::bench::do_not_optimize(g_sum);
+            }
+        }, CElementsCount);
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
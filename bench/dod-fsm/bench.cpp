@@ -0,0 +1,191 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_dod_fsm>
+
+namespace {
+enum class EBenchState : u32 {
+    Patrol = 0,
+    Chase,
+    Guard,
+};
+
+constexpr skl::dod_fsm::SklDoDFsmToolkitSettings CBenchSettings{
+    .default_accumulate_realtime_time = false,
+    .invalid_entity_id                = 0u,
+};
+
+using bench_toolkit_t = skl::dod_fsm::SklDoDFsmToolkit<EBenchState, CBenchSettings>;
+
+//! Every entity stays 1..16 ticks in a state, so ~1/8 of the entities transition each tick
+struct patrol_state_t {
+    static constexpr EBenchState CState = EBenchState::Patrol;
+
+    struct transition_data_t {
+        u32 ticks;
+    };
+
+    patrol_state_t() = default;
+    explicit patrol_state_t(const transition_data_t& f_data)
+        : ticks_left(f_data.ticks) { }
+
+    u32 ticks_left;
+};
+
+struct chase_state_t {
+    static constexpr EBenchState CState = EBenchState::Chase;
+
+    struct transition_data_t {
+        u32 ticks;
+    };
+
+    chase_state_t() = default;
+    explicit chase_state_t(const transition_data_t& f_data)
+        : ticks_left(f_data.ticks) { }
+
+    u32 ticks_left;
+};
+
+//! Sleeps (yield_for) for the whole bench, never ticked after its first tick
+struct guard_state_t {
+    static constexpr EBenchState CState = EBenchState::Guard;
+
+    struct transition_data_t {
+        u32 unused;
+    };
+
+    guard_state_t() = default;
+    explicit guard_state_t(const transition_data_t&) { }
+};
+
+using bench_fsm_t = bench_toolkit_t::FSM<1, patrol_state_t, chase_state_t, guard_state_t>;
+
+[[nodiscard]] u32 next_ticks(u32 f_id, u32 f_ticks_left) noexcept {
+    return 1U + ((f_id * 2654435761U + f_ticks_left) >> 28U);
+}
+
+void spawn_entities(u32 f_count) noexcept {
+    bench_fsm_t::clear();
+    bench_fsm_t::reset_timer();
+    for (u32 id = 1U; id <= f_count; ++id) {
+        bench_fsm_t::enqueue_transition<patrol_state_t>(id, {next_ticks(id, 0U)});
+    }
+    bench_fsm_t::tick();
+}
+
+//! 90% of the entities go to sleep in the Guard state
+void spawn_sleeping_entities(u32 f_count) noexcept {
+    bench_fsm_t::clear();
+    bench_fsm_t::reset_timer();
+    for (u32 id = 1U; id <= f_count; ++id) {
+        if (0U == (id % 10U)) {
+            bench_fsm_t::enqueue_transition<patrol_state_t>(id, {next_ticks(id, 0U)});
+        } else {
+            bench_fsm_t::enqueue_transition<guard_state_t>(id, {0U});
+        }
+    }
+    bench_fsm_t::tick();
+}
+} // namespace
+
+namespace skl::dod_fsm {
+template <>
+EBenchState tick_state<EBenchState::Patrol>(bench_toolkit_t::state_instance_t<patrol_state_t>& f_instance, float, float) noexcept {
+    if (0U == --f_instance.data.ticks_left) {
+        bench_fsm_t::enqueue_transition<chase_state_t>(f_instance.header.id, {next_ticks(f_instance.header.id, 1U)});
+        return EBenchState::Chase;
+    }
+    return EBenchState::Patrol;
+}
+
+template <>
+EBenchState tick_state<EBenchState::Chase>(bench_toolkit_t::state_instance_t<chase_state_t>& f_instance, float, float) noexcept {
+    if (0U == --f_instance.data.ticks_left) {
+        bench_fsm_t::enqueue_transition<patrol_state_t>(f_instance.header.id, {next_ticks(f_instance.header.id, 2U)});
+        return EBenchState::Patrol;
+    }
+    return EBenchState::Chase;
+}
+
+template <>
+EBenchState tick_state<EBenchState::Guard>(bench_toolkit_t::state_instance_t<guard_state_t>&, float, float) noexcept {
+    bench_fsm_t::yield_for(3600000.0f);
+    return EBenchState::Guard;
+}
+} // namespace skl::dod_fsm
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"dod-fsm", argc, argv};
+
+    constexpr u32 CEntityCounts[]  = {10000U, 100000U, 1000000U};
+    const char*   tick_names[]     = {"dod_fsm/tick_10k", "dod_fsm/tick_100k", "dod_fsm/tick_1m"};
+    const char*   churn_names[]    = {"dod_fsm/remove_readd_1pct_10k", "dod_fsm/remove_readd_1pct_100k", "dod_fsm/remove_readd_1pct_1m"};
+    const char*   sleep_names[]    = {"dod_fsm/tick_90pct_sleeping_10k", "dod_fsm/tick_90pct_sleeping_100k", "dod_fsm/tick_90pct_sleeping_1m"};
+    const char*   parallel_names[] = {"dod_fsm/tick_parallel_10k", "dod_fsm/tick_parallel_100k", "dod_fsm/tick_parallel_1m"};
+
+    // One worker per available cpu
+    skl::dod_fsm::tick_worker_pool_t pool;
+    if (pool.create().is_failure()) {
+        return 1;
+    }
+
+    for (u32 i = 0U; i < 3U; ++i) {
+        const u32 entities = CEntityCounts[i];
+
+        spawn_entities(entities);
+        runner.run(tick_names[i], [](u64 f_iterations) noexcept {
+            for (u64 j = 0U; j < f_iterations; ++j) {
+                bench_fsm_t::tick();
+            }
+            skl::bench::do_not_optimize(bench_fsm_t::get_state_instances_vector<patrol_state_t>().size());
+        }, entities);
+
+        // 1% of the entities despawn and respawn each tick
+        spawn_entities(entities);
+        runner.run(churn_names[i], [entities](u64 f_iterations) noexcept {
+            const u32 churn = entities / 100U;
+            u32       next  = 1U;
+            for (u64 j = 0U; j < f_iterations; ++j) {
+                const u32 first = next;
+                for (u32 k = 0U; k < churn; ++k) {
+                    bench_fsm_t::remove_entity(next);
+                    next = (next % entities) + 1U;
+                }
+                bench_fsm_t::tick();
+
+                for (u32 k = 0U, id = first; k < churn; ++k) {
+                    bench_fsm_t::enqueue_transition<patrol_state_t>(id, {next_ticks(id, 3U)});
+                    id = (id % entities) + 1U;
+                }
+            }
+            skl::bench::do_not_optimize(bench_fsm_t::get_state_instances_vector<patrol_state_t>().size());
+        }, entities);
+
+        // Only the awake 10% are ticked
+        spawn_sleeping_entities(entities);
+        runner.run(sleep_names[i], [](u64 f_iterations) noexcept {
+            for (u64 j = 0U; j < f_iterations; ++j) {
+                bench_fsm_t::tick();
+            }
+            skl::bench::do_not_optimize(bench_fsm_t::get_state_instances_vector<patrol_state_t>().size());
+        }, entities);
+
+        spawn_entities(entities);
+        runner.run(parallel_names[i], [&pool](u64 f_iterations) noexcept {
+            for (u64 j = 0U; j < f_iterations; ++j) {
+                bench_fsm_t::tick_parallel(pool);
+            }
+            skl::bench::do_not_optimize(bench_fsm_t::get_state_instances_vector<patrol_state_t>().size());
+        }, entities);
+    }
+
+    bench_fsm_t::clear();
+    pool.destroy();
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
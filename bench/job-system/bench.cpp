@@ -0,0 +1,84 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_job_system>
+
+#include <vector>
+
+namespace {
+constexpr u32 CChildrenCount = 1024U;
+constexpr u32 CElementsCount = 1U << 20U;
+constexpr u32 CGrainSize     = 4096U;
+
+//! Root job + CChildrenCount empty children, returns after all of them finished
+void fork_join_empty(skl::job_system_t& f_system) noexcept {
+    skl::job_t* root = f_system.create_job([]() noexcept {});
+    for (u32 i = 0U; i < CChildrenCount; ++i) {
+        f_system.run(f_system.create_child_job(*root, []() noexcept {}));
+    }
+    f_system.run(root);
+    f_system.wait(root);
+}
+
+void run_benchmarks(skl::bench::BenchRunner& f_runner, skl::job_system_t& f_system, const char* f_round_trip_name, const char* f_fork_join_name, const char* f_parallel_for_name) noexcept {
+    // Dispatch overhead of a single job (allocate, push, pop or steal, call, finish)
+    f_runner.run(f_round_trip_name, [&f_system](u64 f_iterations) noexcept {
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            skl::job_t* job = f_system.create_job([]() noexcept {});
+            f_system.run(job);
+            f_system.wait(job);
+        }
+    });
+
+    // Per job overhead when fanning out (the children are stolen by the other workers)
+    f_runner.run(f_fork_join_name, [&f_system](u64 f_iterations) noexcept {
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            fork_join_empty(f_system);
+        }
+    }, CChildrenCount);
+
+    // Sum of 1M elements, per element cost
+    static std::vector<u32> elements(CElementsCount, 1U);
+    static u64              partial_sums[CElementsCount / CGrainSize];
+    f_runner.run(f_parallel_for_name, [&f_system](u64 f_iterations) noexcept {
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            f_system.parallel_for(0U, CElementsCount, CGrainSize, [](u32 f_begin, u32 f_end) noexcept {
+                u64 sum = 0U;
+                for (u32 j = f_begin; j < f_end; ++j) {
+                    sum += elements[j];
+                }
+                partial_sums[f_begin / CGrainSize] = sum;
+            });
+            skl::bench::do_not_optimize(partial_sums);
+        }
+    }, CElementsCount);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"job-system", argc, argv};
+
+    {
+        skl::job_system_t system;
+        if (system.create({.m_workers_count = 1U}).is_failure()) {
+            return 1;
+        }
+        run_benchmarks(runner, system, "job_system/round_trip_1_worker", "job_system/fork_join_1k_1_worker", "job_system/parallel_for_1m_1_worker");
+    }
+
+    {
+        // One worker per available cpu
+        skl::job_system_t system;
+        if (system.create().is_failure()) {
+            return 1;
+        }
+        run_benchmarks(runner, system, "job_system/round_trip_all_workers", "job_system/fork_join_1k_all_workers", "job_system/parallel_for_1m_all_workers");
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
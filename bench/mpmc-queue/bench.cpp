@@ -0,0 +1,170 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_mpmc_queue>
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace {
+struct message_t {
+    u64 m_sequence;
+    u64 m_payload[3];
+};
+
+constexpr u64 CQueueSize = 4096U;
+constexpr u32 CBurstSize = 32U;
+
+using queue_t = skl::mpmc_queue_t<message_t, CQueueSize, false>;
+
+//! Baseline: bounded std::deque guarded by a std::mutex
+struct mutex_deque_queue_t {
+    [[nodiscard]] bool try_enqueue(const message_t& f_message) noexcept {
+        std::lock_guard guard{m_mutex};
+        if (m_queue.size() >= CQueueSize) {
+            return false;
+        }
+        m_queue.push_back(f_message);
+        return true;
+    }
+
+    [[nodiscard]] u32 try_enqueue_burst(const message_t* f_messages, u32 f_count) noexcept {
+        std::lock_guard guard{m_mutex};
+        u32             count = 0U;
+        for (; (count < f_count) && (m_queue.size() < CQueueSize); ++count) {
+            m_queue.push_back(f_messages[count]);
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool try_dequeue(message_t& f_out_message) noexcept {
+        std::lock_guard guard{m_mutex};
+        if (m_queue.empty()) {
+            return false;
+        }
+        f_out_message = m_queue.front();
+        m_queue.pop_front();
+        return true;
+    }
+
+    [[nodiscard]] u32 try_dequeue_burst(message_t* f_out_messages, u32 f_max_count) noexcept {
+        std::lock_guard guard{m_mutex};
+        u32             count = 0U;
+        for (; (count < f_max_count) && (false == m_queue.empty()); ++count) {
+            f_out_messages[count] = m_queue.front();
+            m_queue.pop_front();
+        }
+        return count;
+    }
+
+    std::mutex            m_mutex;
+    std::deque<message_t> m_queue;
+};
+
+//! Enqueue then dequeue CBurstSize messages on the same thread (uncontended cost)
+template <typename _Queue>
+void round_trip_burst(_Queue& f_queue, u64 f_iterations) noexcept {
+    message_t burst[CBurstSize]{};
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        burst[0U].m_sequence = i;
+        (void)f_queue.try_enqueue_burst(burst, CBurstSize);
+        const u32 count = f_queue.try_dequeue_burst(burst, CBurstSize);
+        skl::bench::do_not_optimize(burst[count - 1U].m_sequence);
+    }
+}
+
+//! Move f_iterations messages from f_threads producers to f_threads consumers
+//! \remark With f_burst the producers and consumers move CBurstSize messages per call
+template <typename _Queue>
+void producers_consumers(_Queue& f_queue, u32 f_threads, bool f_burst, u64 f_iterations) noexcept {
+    std::relaxed_value<u64>  consumed{0U};
+    std::vector<std::thread> threads;
+    threads.reserve(u64(f_threads) * 2U);
+
+    for (u32 p = 0U; p < f_threads; ++p) {
+        const u64 count = (f_iterations / f_threads) + ((p < (f_iterations % f_threads)) ? 1U : 0U);
+        threads.emplace_back([&f_queue, count, f_burst]() noexcept {
+            message_t burst[CBurstSize]{};
+            for (u64 i = 0U; i < count;) {
+                u32 pushed = 0U;
+                if (f_burst) {
+                    const u64 remaining = count - i;
+                    pushed              = f_queue.try_enqueue_burst(burst, remaining < CBurstSize ? u32(remaining) : CBurstSize);
+                } else {
+                    burst[0U].m_sequence = i;
+                    pushed               = f_queue.try_enqueue(burst[0U]) ? 1U : 0U;
+                }
+
+                if (0U == pushed) {
+                    std::this_thread::yield();
+                }
+                i += pushed;
+            }
+        });
+    }
+
+    for (u32 c = 0U; c < f_threads; ++c) {
+        threads.emplace_back([&f_queue, &consumed, f_iterations, f_burst]() noexcept {
+            message_t burst[CBurstSize];
+            u64       checksum = 0U;
+            while (consumed.load_relaxed() < f_iterations) {
+                u32 popped = 0U;
+                if (f_burst) {
+                    popped = f_queue.try_dequeue_burst(burst, CBurstSize);
+                } else {
+                    popped = f_queue.try_dequeue(burst[0U]) ? 1U : 0U;
+                }
+
+                if (0U == popped) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                checksum += burst[0U].m_sequence;
+                (void)consumed.increment(popped);
+            }
+            skl::bench::do_not_optimize(checksum);
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+template <typename _Queue>
+void run_suite(skl::bench::BenchRunner& f_runner, const char* f_name, _Queue& f_queue) noexcept {
+    f_runner.run((std::string(f_name) + "/round_trip_burst32").c_str(), [&f_queue](u64 f_iterations) noexcept { round_trip_burst(f_queue, f_iterations); }, CBurstSize);
+
+    for (const u32 threads : {1U, 2U, 4U, 8U}) {
+        for (const bool burst : {false, true}) {
+            const std::string name = std::string(f_name) + (burst ? "/burst32" : "/single") + "/threads:" + std::to_string(threads) + "x" + std::to_string(threads);
+            f_runner.run(name.c_str(), [&f_queue, threads, burst](u64 f_iterations) noexcept { producers_consumers(f_queue, threads, burst, f_iterations); });
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"mpmc-queue", argc, argv};
+
+    {
+        auto queue = std::make_unique<queue_t>();
+        run_suite(runner, "mpmc_queue_t", *queue);
+    }
+
+    {
+        auto queue = std::make_unique<mutex_deque_queue_t>();
+        run_suite(runner, "mutex_deque", *queue);
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,94 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_mpsc_ring>
+
+#include <thread>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace {
+struct message_t {
+    u64 m_sequence;
+    u64 m_payload[3];
+};
+
+constexpr u64 CRingSize  = 4096U;
+constexpr u32 CBurstSize = 32U;
+
+using ring_t = skl::mpsc_ring_t<message_t, CRingSize, false>;
+
+//! Produce then consume CBurstSize messages on the same thread (instruction cost of the ring protocol)
+void round_trip_burst(ring_t& f_ring, u64 f_iterations) noexcept {
+    message_t* burst[CBurstSize];
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        (void)f_ring.allocate_bulk(burst, CBurstSize);
+        for (u32 j = 0U; j < CBurstSize; ++j) {
+            burst[j]->m_sequence = j;
+        }
+        f_ring.submit(burst, CBurstSize);
+
+        const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+        skl::bench::do_not_optimize(burst[count - 1U]->m_sequence);
+        f_ring.free_processed();
+    }
+}
+
+//! Stream f_iterations messages from f_producers threads to this (consumer) thread
+//! \remark Producers submit one message per claim to measure the contention on the claim head
+void contended_stream(ring_t& f_ring, u32 f_producers, u64 f_iterations) noexcept {
+    std::vector<std::thread> producers;
+    producers.reserve(f_producers);
+    for (u32 p = 0U; p < f_producers; ++p) {
+        const u64 count = (f_iterations / f_producers) + ((p < (f_iterations % f_producers)) ? 1U : 0U);
+        producers.emplace_back([&f_ring, count]() noexcept {
+            for (u64 i = 0U; i < count; ++i) {
+                message_t* message = nullptr;
+                while (nullptr == (message = f_ring.allocate())) {
+                    // Up to 32 producers oversubscribe most machines, let the consumer run
+                    std::this_thread::yield();
+                }
+                message->m_sequence = i;
+                f_ring.submit(message);
+            }
+        });
+    }
+
+    message_t* burst[CBurstSize];
+    u64        received = 0U;
+    u64        checksum = 0U;
+    while (received < f_iterations) {
+        const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+        for (u32 j = 0U; j < count; ++j) {
+            checksum += burst[j]->m_sequence;
+        }
+        received += count;
+        f_ring.free_processed();
+    }
+    skl::bench::do_not_optimize(checksum);
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"mpsc-ring", argc, argv};
+
+    auto ring = std::make_unique<ring_t>();
+    runner.run("mpsc_ring_t/round_trip_burst32", [&ring](u64 f_iterations) noexcept { round_trip_burst(*ring, f_iterations); }, CBurstSize);
+
+    for (const u32 producers : {1U, 2U, 4U, 8U, 16U, 32U}) {
+        const std::string name = "mpsc_ring_t/contended_stream/producers:" + std::to_string(producers);
+        runner.run(name.c_str(), [&ring, producers](u64 f_iterations) noexcept { contended_stream(*ring, producers, f_iterations); });
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,75 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_pool/stable_object_pool>
+#include <skl_pool/concurrent_stable_object_pool>
+
+namespace {
+struct object_t {
+    u64 m_a;
+    u64 m_b;
+    u64 m_c;
+    u64 m_d;
+};
+
+constexpr u64 CBlockSize = 1024U;
+constexpr u32 CBatchSize = 256U;
+
+template <typename _Pool>
+void alloc_free_single(_Pool& f_pool, u64 f_iterations) noexcept {
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        auto* object = f_pool.allocate();
+        skl::bench::do_not_optimize(object);
+        f_pool.deallocate(object);
+    }
+}
+
+//! Allocate CBatchSize objects then free them in allocation order (FIFO, touches the free list tail)
+template <typename _Pool>
+void alloc_free_batch(_Pool& f_pool, u64 f_iterations) noexcept {
+    object_t* objects[CBatchSize];
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        for (u32 j = 0U; j < CBatchSize; ++j) {
+            objects[j] = f_pool.allocate();
+        }
+        skl::bench::clobber_memory();
+        for (u32 j = 0U; j < CBatchSize; ++j) {
+            f_pool.deallocate(objects[j]);
+        }
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"object-pools", argc, argv};
+
+    {
+        skl::StableObjectPool<object_t, CBlockSize> pool{};
+        runner.run("StableObjectPool/alloc_free", [&pool](u64 f_iterations) noexcept { alloc_free_single(pool, f_iterations); });
+        runner.run("StableObjectPool/alloc_free_batch256", [&pool](u64 f_iterations) noexcept { alloc_free_batch(pool, f_iterations); }, CBatchSize);
+
+        auto* object = pool.allocate();
+        runner.run("StableObjectPool/owns", [&pool, object](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                auto* query = object;
+                skl::bench::do_not_optimize(query);
+                skl::bench::do_not_optimize(pool.owns(query));
+            }
+        });
+        pool.deallocate(object);
+    }
+
+    {
+        skl::ConcurrentStableObjectPool<object_t, CBlockSize> pool{};
+        runner.run("ConcurrentStableObjectPool/alloc_free", [&pool](u64 f_iterations) noexcept { alloc_free_single(pool, f_iterations); });
+        runner.run("ConcurrentStableObjectPool/alloc_free_batch256", [&pool](u64 f_iterations) noexcept { alloc_free_batch(pool, f_iterations); }, CBatchSize);
+        pool.release_thread_heap();
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,57 @@
+#include <skl_bench>
+#include <skl_log>
+#include <skl_core>
+#include <skl_logger/skl_slogger_sink.hpp>
+
+#define SKL_LOG_TAG "[SLoggerBench] -- "
+
+namespace {
+//! Front-end cost of one log call to the file sink (the sink thread writes to /dev/null)
+void log_to_file_sink(skl::bench::BenchRunner& f_runner, const char* f_name, skl::ESLoggerFileSinkFormat f_format) noexcept {
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = "/dev/null";
+    config.m_truncate          = false;
+    config.m_format            = f_format;
+    config.m_flush_interval_ms = 10U;
+
+    if ((SKL_SUCCESS != skl::SLoggerSinkManager::setup_file_sink(config))
+        || skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_failure()) {
+        (void)fprintf(stderr, "Failed to setup the file sink!\n");
+        return;
+    }
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+
+    f_runner.run(f_name, [](u64 f_iterations) noexcept {
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            SINFO("bench value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+        }
+    });
+
+    (void)skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId);
+    (void)skl::SLoggerSinkManager::close_file_sink();
+
+    const auto after = skl::SLoggerSinkManager::get_file_sink_stats();
+    (void)printf("    records=%llu dropped=%llu\n",
+                 static_cast<unsigned long long>(after.m_records_count - before.m_records_count),
+                 static_cast<unsigned long long>(after.m_dropped_count - before.m_dropped_count));
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting slogger benchmarks");
+
+    skl::bench::BenchRunner runner{"slogger", argc, argv};
+
+    log_to_file_sink(runner, "SLogger/SINFO_2_args/file_sink_text", skl::ESLoggerFileSinkFormat::Text);
+    log_to_file_sink(runner, "SLogger/SINFO_2_args/file_sink_binary", skl::ESLoggerFileSinkFormat::Binary);
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
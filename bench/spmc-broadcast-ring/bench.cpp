@@ -0,0 +1,141 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_spmc_broadcast_ring>
+#include <skl_spsc_unidirectional_ring>
+
+#include <thread>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace {
+struct event_t {
+    u64 m_sequence;
+    u64 m_payload[7];
+};
+
+constexpr u64 CRingSize     = 4096U;
+constexpr u32 CBurstSize    = 32U;
+constexpr u32 CMaxConsumers = 8U;
+
+using broadcast_ring_t = skl::spmc_broadcast_ring_t<event_t, CRingSize, CMaxConsumers, false>;
+using spsc_ring_t      = skl::spsc_unidirectional_ring_t<event_t, CRingSize, false>;
+
+//! Publish f_iterations events once, each of the f_consumers threads reads all of them in place
+void broadcast_fan_out(broadcast_ring_t& f_ring, u32 f_consumers, u64 f_iterations) noexcept {
+    skl::spmc_consumer_id_t ids[CMaxConsumers];
+    for (u32 c = 0U; c < f_consumers; ++c) {
+        ids[c] = f_ring.add_consumer();
+    }
+
+    std::vector<std::thread> consumers;
+    for (u32 c = 0U; c < f_consumers; ++c) {
+        consumers.emplace_back([&f_ring, id = ids[c], f_iterations]() noexcept {
+            const event_t* burst[CBurstSize];
+            u64            received = 0U;
+            u64            checksum = 0U;
+            while (received < f_iterations) {
+                const u32 count = f_ring.dequeue_burst(id, burst, CBurstSize);
+                for (u32 j = 0U; j < count; ++j) {
+                    checksum += burst[j]->m_sequence;
+                }
+                received += count;
+                f_ring.free_processed(id);
+                if (0U == count) {
+                    std::this_thread::yield();
+                }
+            }
+            skl::bench::do_not_optimize(checksum);
+        });
+    }
+
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        event_t* event = nullptr;
+        while (nullptr == (event = f_ring.allocate())) {
+            f_ring.submit();
+            std::this_thread::yield();
+        }
+        event->m_sequence = i;
+        if (0U == (i & (CBurstSize - 1U))) {
+            f_ring.submit();
+        }
+    }
+    f_ring.submit();
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    for (u32 c = 0U; c < f_consumers; ++c) {
+        f_ring.remove_consumer(ids[c]);
+    }
+}
+
+//! Baseline: copy each of the f_iterations events into one spsc ring per consumer
+void spsc_copies_fan_out(spsc_ring_t* f_rings, u32 f_consumers, u64 f_iterations) noexcept {
+    std::vector<std::thread> consumers;
+    for (u32 c = 0U; c < f_consumers; ++c) {
+        consumers.emplace_back([&ring = f_rings[c], f_iterations]() noexcept {
+            event_t* burst[CBurstSize];
+            u64      received = 0U;
+            u64      checksum = 0U;
+            while (received < f_iterations) {
+                const u32 count = ring.dequeue_burst(burst, CBurstSize);
+                for (u32 j = 0U; j < count; ++j) {
+                    checksum += burst[j]->m_sequence;
+                }
+                received += count;
+                ring.free_processed();
+                if (0U == count) {
+                    std::this_thread::yield();
+                }
+            }
+            skl::bench::do_not_optimize(checksum);
+        });
+    }
+
+    event_t event{};
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        event.m_sequence = i;
+        for (u32 c = 0U; c < f_consumers; ++c) {
+            event_t* copy = nullptr;
+            while (nullptr == (copy = f_rings[c].allocate())) {
+                f_rings[c].submit();
+                std::this_thread::yield();
+            }
+            *copy = event;
+            if (0U == (i & (CBurstSize - 1U))) {
+                f_rings[c].submit();
+            }
+        }
+    }
+    for (u32 c = 0U; c < f_consumers; ++c) {
+        f_rings[c].submit();
+    }
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"spmc-broadcast-ring", argc, argv};
+
+    auto ring  = std::make_unique<broadcast_ring_t>();
+    auto rings = std::make_unique<spsc_ring_t[]>(CMaxConsumers);
+
+    for (const u32 consumers : {1U, 2U, 4U, 8U}) {
+        const std::string suffix = "/consumers:" + std::to_string(consumers);
+        runner.run(("spmc_broadcast_ring_t/fan_out" + suffix).c_str(), [&ring, consumers](u64 f_iterations) noexcept { broadcast_fan_out(*ring, consumers, f_iterations); });
+        runner.run(("spsc_copies/fan_out" + suffix).c_str(), [&rings, consumers](u64 f_iterations) noexcept { spsc_copies_fan_out(rings.get(), consumers, f_iterations); });
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
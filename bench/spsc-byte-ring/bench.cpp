@@ -0,0 +1,123 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_spsc_byte_ring>
+#include <skl_spsc_unidirectional_ring>
+
+#include <cstring>
+#include <thread>
+#include <memory>
+
+namespace {
+constexpr u64 CByteRingSize  = 1024U * 1024U;
+constexpr u32 CMaxRecordSize = 1024U;
+constexpr u64 CSlotsCount    = CByteRingSize / CMaxRecordSize;
+constexpr u32 CBurstSize     = 32U;
+
+//! Fixed size slot able to hold the largest record
+struct slot_t {
+    u32  m_length;
+    byte m_data[CMaxRecordSize - sizeof(u32)];
+};
+
+using slot_ring_t = skl::spsc_unidirectional_ring_t<slot_t, CSlotsCount, false>;
+
+//! Record sizes cycle through small (typical log/packet) and occasional large records
+[[nodiscard]] u32 record_size_of(u64 f_index) noexcept {
+    return (0U == (f_index & 15U)) ? (CMaxRecordSize - sizeof(u32)) : u32(16U + ((f_index * 37U) & 127U));
+}
+
+//! Stream f_iterations variable size records through the byte ring (zero-copy, records packed)
+void byte_ring_stream(skl::spsc_byte_ring_t& f_ring, u64 f_iterations) noexcept {
+    std::thread consumer{[&f_ring, f_iterations]() noexcept {
+        u64 received = 0U;
+        u64 checksum = 0U;
+        while (received < f_iterations) {
+            const u64 before = received;
+            for (auto record = f_ring.peek(); record.is_valid(); record = f_ring.peek()) {
+                checksum += u64(record.buffer[0U]) + record.length;
+                ++received;
+            }
+            f_ring.release();
+            if (before == received) {
+                std::this_thread::yield();
+            }
+        }
+        skl::bench::do_not_optimize(checksum);
+    }};
+
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        const u32            size = record_size_of(i);
+        skl::skl_buffer_view view{};
+        while (false == (view = f_ring.reserve(size)).is_valid()) {
+            std::this_thread::yield();
+        }
+        std::memset(view.buffer, int(i & 0xFFU), size);
+        f_ring.commit(size);
+    }
+
+    consumer.join();
+}
+
+//! Baseline: each variable size record takes a whole max size slot
+void slot_ring_stream(slot_ring_t& f_ring, u64 f_iterations) noexcept {
+    std::thread consumer{[&f_ring, f_iterations]() noexcept {
+        slot_t* burst[CBurstSize];
+        u64     received = 0U;
+        u64     checksum = 0U;
+        while (received < f_iterations) {
+            const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+            for (u32 j = 0U; j < count; ++j) {
+                checksum += u64(burst[j]->m_data[0U]) + burst[j]->m_length;
+            }
+            received += count;
+            f_ring.free_processed();
+            if (0U == count) {
+                std::this_thread::yield();
+            }
+        }
+        skl::bench::do_not_optimize(checksum);
+    }};
+
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        const u32 size = record_size_of(i);
+        slot_t*   slot = nullptr;
+        while (nullptr == (slot = f_ring.allocate())) {
+            f_ring.submit();
+            std::this_thread::yield();
+        }
+        slot->m_length = size;
+        std::memset(slot->m_data, int(i & 0xFFU), size);
+        if (0U == (i & (CBurstSize - 1U))) {
+            f_ring.submit();
+        }
+    }
+    f_ring.submit();
+
+    consumer.join();
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"spsc-byte-ring", argc, argv};
+
+    auto byte_ring = std::make_unique<skl::spsc_byte_ring_t>();
+    if (byte_ring->create(CByteRingSize).is_failure()) {
+        (void)skl::skl_core_deinit();
+        return 1;
+    }
+
+    auto slot_ring = std::make_unique<slot_ring_t>();
+
+    runner.run("spsc_byte_ring_t/variable_size_stream", [&byte_ring](u64 f_iterations) noexcept { byte_ring_stream(*byte_ring, f_iterations); });
+    runner.run("spsc_unidirectional_ring_t/max_size_slots_stream", [&slot_ring](u64 f_iterations) noexcept { slot_ring_stream(*slot_ring, f_iterations); });
+
+    byte_ring->destroy();
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,250 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_spsc_ring>
+#include <skl_spsc_unidirectional_ring>
+#include <skl_spsc_bidirectional_ring>
+#include <skl_thread>
+#include <skl_sleep>
+
+#include <cstdio>
+#include <thread>
+#include <memory>
+
+namespace {
+struct message_t {
+    u64 m_sequence;
+    u64 m_payload[3];
+};
+
+constexpr u64 CRingSize             = 4096U;
+constexpr u32 CBurstSize            = 32U;
+constexpr u32 CSpinCountBeforeYield = 64U;
+
+//! Reference ring: the same spsc protocol without the cached remote indices
+//! \remark Every allocate() loads the queue tail and every dequeue_burst() loads the queue head
+template <typename _Object, u64 _Size>
+struct SKL_CACHE_ALIGNED uncached_spsc_ring_t {
+    static constexpr u64 Mask = _Size - 1U;
+
+    [[nodiscard]] _Object* allocate() noexcept {
+        if (_Size == (m_allocate_head - m_queue_tail.load_acquire())) {
+            return nullptr;
+        }
+        return &m_objects[(m_allocate_head++) & Mask];
+    }
+
+    void submit() noexcept {
+        m_queue_head.store_release(m_allocate_head);
+    }
+
+    [[nodiscard]] u32 dequeue_burst(_Object** f_out_objects, u32 f_max_count) noexcept {
+        const auto delta = m_queue_head.load_acquire() - m_process_head;
+
+        u32 result = 0U;
+        for (; (result < delta) && (result < f_max_count); ++result) {
+            f_out_objects[result] = &m_objects[(m_process_head + result) & Mask];
+        }
+        m_process_head += result;
+
+        return result;
+    }
+
+    void free_processed() noexcept {
+        m_queue_tail.store_release(m_process_head);
+    }
+
+    SKL_CACHE_ALIGNED u64 m_allocate_head                  = 0ULL;
+    SKL_CACHE_ALIGNED std::relaxed_value<u64> m_queue_head = 0ULL;
+    SKL_CACHE_ALIGNED std::relaxed_value<u64> m_queue_tail = 0ULL;
+    SKL_CACHE_ALIGNED u64 m_process_head                   = 0ULL;
+    SKL_CACHE_ALIGNED _Object m_objects[_Size];
+};
+
+//! Pin the calling thread on \p f_core (-1 = no affinity)
+void pin_current_thread(i16 f_core) noexcept {
+    (void)skl::SKLThread::set_thread_affinity({f_core, f_core});
+}
+
+//! Spin (pause) for a while, then yield
+void back_off(u32& f_spins) noexcept {
+    if (++f_spins < CSpinCountBeforeYield) {
+        __builtin_ia32_pause();
+    } else {
+        f_spins = 0U;
+        skl::skl_yield();
+    }
+}
+
+//! Produce then consume CBurstSize messages on the same thread (instruction cost of the ring protocol)
+template <typename _Ring>
+void round_trip_burst(_Ring& f_ring, u64 f_iterations) noexcept {
+    message_t* burst[CBurstSize];
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        for (u32 j = 0U; j < CBurstSize; ++j) {
+            auto* message       = f_ring.allocate();
+            message->m_sequence = j;
+        }
+        f_ring.submit();
+
+        const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+        skl::bench::do_not_optimize(burst[count - 1U]->m_sequence);
+        f_ring.free_processed();
+    }
+}
+
+//! Stream f_iterations messages from this thread to a consumer thread (pinned on \p f_consumer_core)
+template <typename _Ring>
+void cross_thread_stream(_Ring& f_ring, u64 f_iterations, i16 f_consumer_core = -1) noexcept {
+    std::thread consumer{[&f_ring, f_iterations, f_consumer_core]() noexcept {
+        pin_current_thread(f_consumer_core);
+
+        message_t* burst[CBurstSize];
+        u64        received = 0U;
+        u64        checksum = 0U;
+        while (received < f_iterations) {
+            const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+            for (u32 j = 0U; j < count; ++j) {
+                checksum += burst[j]->m_sequence;
+            }
+            received += count;
+            f_ring.free_processed();
+        }
+        skl::bench::do_not_optimize(checksum);
+    }};
+
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        message_t* message = nullptr;
+        while (nullptr == (message = f_ring.allocate())) {
+            f_ring.submit();
+            __builtin_ia32_pause();
+        }
+        message->m_sequence = i;
+        if (0U == (i & (CBurstSize - 1U))) {
+            f_ring.submit();
+        }
+    }
+    f_ring.submit();
+
+    consumer.join();
+}
+
+//! One message in flight: this thread sends it through \p f_ping, the echo thread (pinned on \p f_echo_core) sends it back through \p f_pong
+template <typename _Ring>
+void ping_pong(_Ring& f_ping, _Ring& f_pong, u64 f_iterations, i16 f_echo_core) noexcept {
+    std::thread echo{[&f_ping, &f_pong, f_iterations, f_echo_core]() noexcept {
+        pin_current_thread(f_echo_core);
+
+        message_t* ping  = nullptr;
+        u32        spins = 0U;
+        for (u64 i = 0U; i < f_iterations; ++i) {
+            while (0U == f_ping.dequeue_burst(&ping, 1U)) {
+                back_off(spins);
+            }
+
+            auto* pong       = f_pong.allocate();
+            pong->m_sequence = ping->m_sequence;
+            f_ping.free_processed();
+            f_pong.submit();
+        }
+    }};
+
+    message_t* pong  = nullptr;
+    u32        spins = 0U;
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        f_ping.allocate()->m_sequence = i;
+        f_ping.submit();
+
+        while (0U == f_pong.dequeue_burst(&pong, 1U)) {
+            back_off(spins);
+        }
+        skl::bench::do_not_optimize(pong->m_sequence);
+        f_pong.free_processed();
+    }
+
+    echo.join();
+}
+
+//! Request/response round trip through the bidirectional ring (producer -> consumer -> producer)
+template <typename _Ring>
+void bidirectional_round_trip_burst(_Ring& f_ring, u64 f_iterations) noexcept {
+    message_t* burst[CBurstSize];
+    for (u64 i = 0U; i < f_iterations; ++i) {
+        for (u32 j = 0U; j < CBurstSize; ++j) {
+            auto* message       = f_ring.allocate();
+            message->m_sequence = j;
+        }
+        f_ring.submit();
+
+        const u32 count = f_ring.dequeue_burst(burst, CBurstSize);
+        for (u32 j = 0U; j < count; ++j) {
+            burst[j]->m_payload[0] = burst[j]->m_sequence;
+        }
+        f_ring.submit_results();
+
+        const u32 results = f_ring.dequeue_results_burst(burst, CBurstSize);
+        skl::bench::do_not_optimize(burst[results - 1U]->m_payload[0]);
+        f_ring.submit_processed_results();
+    }
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"spsc-rings", argc, argv};
+
+    {
+        auto ring = std::make_unique<spsc_ring_t<message_t, CRingSize>>();
+        runner.run("spsc_ring_t/round_trip_burst32", [&ring](u64 f_iterations) noexcept { round_trip_burst(*ring, f_iterations); }, CBurstSize);
+        runner.run("spsc_ring_t/cross_thread_stream", [&ring](u64 f_iterations) noexcept { cross_thread_stream(*ring, f_iterations); });
+    }
+
+    {
+        auto ring = std::make_unique<skl::spsc_unidirectional_ring_t<message_t, CRingSize, false>>();
+        runner.run("spsc_unidirectional_ring_t/round_trip_burst32", [&ring](u64 f_iterations) noexcept { round_trip_burst(*ring, f_iterations); }, CBurstSize);
+        runner.run("spsc_unidirectional_ring_t/cross_thread_stream", [&ring](u64 f_iterations) noexcept { cross_thread_stream(*ring, f_iterations); });
+    }
+
+    {
+        auto ring = std::make_unique<skl::spsc_bidirectional_ring_t<message_t, CRingSize, false>>();
+        runner.run("spsc_bidirectional_ring_t/round_trip_burst32", [&ring](u64 f_iterations) noexcept { bidirectional_round_trip_burst(*ring, f_iterations); }, CBurstSize);
+    }
+
+    // Cross core: this thread and the other side pinned on two different cores
+    {
+        u16        cores[256U];
+        const auto cores_count = skl::SKLThread::get_process_usable_cores(cores, 256U);
+
+        i16 producer_core = -1;
+        i16 consumer_core = -1;
+        if (cores_count.is_success() && (2U <= cores_count.value())) {
+            producer_core = i16(cores[0U]);
+            consumer_core = i16(cores[1U]);
+        } else {
+            (void)std::fprintf(stderr, "[spsc-rings] Less than 2 usable cores, the pinned benchmarks run without affinity\n");
+        }
+
+        pin_current_thread(producer_core);
+
+        using ring_t          = skl::spsc_unidirectional_ring_t<message_t, CRingSize, false>;
+        using uncached_ring_t = uncached_spsc_ring_t<message_t, CRingSize>;
+
+        auto ping          = std::make_unique<ring_t>();
+        auto pong          = std::make_unique<ring_t>();
+        auto uncached_ping = std::make_unique<uncached_ring_t>();
+        auto uncached_pong = std::make_unique<uncached_ring_t>();
+
+        runner.run("spsc_unidirectional_ring_t/pinned_ping_pong", [&ping, &pong, consumer_core](u64 f_iterations) noexcept { ping_pong(*ping, *pong, f_iterations, consumer_core); });
+        runner.run("uncached_spsc_ring/pinned_ping_pong", [&uncached_ping, &uncached_pong, consumer_core](u64 f_iterations) noexcept { ping_pong(*uncached_ping, *uncached_pong, f_iterations, consumer_core); });
+        runner.run("spsc_unidirectional_ring_t/pinned_stream", [&ping, consumer_core](u64 f_iterations) noexcept { cross_thread_stream(*ping, f_iterations, consumer_core); });
+        runner.run("uncached_spsc_ring/pinned_stream", [&uncached_ping, consumer_core](u64 f_iterations) noexcept { cross_thread_stream(*uncached_ping, f_iterations, consumer_core); });
+
+        pin_current_thread(-1);
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,168 @@
+#include <skl_bench>
+#include <skl_core>
+#include <skl_rand>
+#include <skl_timing/timer_wheel>
+#include <skl_timing/htimer_wheel>
+
+#include <memory>
+#include <vector>
+
+namespace {
+struct timer_data_t {
+    u64 m_value{0U};
+};
+
+using timer_wheel_t  = skl::TimerWheel<timer_data_t, 1000U, 10U>;
+using hier_wheel_t   = skl::HierarchicalWheel<>;
+using tick_functor_t = decltype([](timer_wheel_t::wheel_entry_t& f_entry) static noexcept { skl::bench::do_not_optimize(f_entry.m_value); });
+
+constexpr u32 CTimersCount = 4096U;
+constexpr u32 CTimersMask  = CTimersCount - 1U;
+
+//! Random delays, precomputed so the rng is not measured
+u32 g_delays[CTimersCount];
+
+//! Large wheel working set (up to 1 minute at 256hz)
+constexpr u32 CLargeTimersCount = 1U << 20U;
+constexpr u64 CLargeMaxTick     = 256U * 60U;
+
+//! Live timers kept by the timer thread benchmark
+constexpr u32 CLiveTimersCount = 50'000U;
+
+using service_t = skl::HTimerWheel<4U, 65536U, 65536U>;
+} // namespace
+
+int main(int argc, char** argv) {
+    if (skl::skl_core_init().is_failure()) {
+        return 1;
+    }
+
+    skl::bench::BenchRunner runner{"timer-wheels", argc, argv};
+
+    {
+        skl::SklRand rand{};
+        for (auto& delay : g_delays) {
+            delay = rand.next_range(0U, timer_wheel_t::CWheelTimeMs - 1U);
+        }
+
+        auto                     wheel = std::make_unique<timer_wheel_t>();
+        skl::epoch_time_point_t  now   = 0U;
+        runner.run("TimerWheel/allocate_expire_4096", [&wheel, &now](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                for (u32 j = 0U; j < CTimersCount; ++j) {
+                    skl::bench::do_not_optimize(wheel->allocate(g_delays[j], timer_data_t{j}).second);
+                }
+                for (u32 j = 0U; j < timer_wheel_t::CWheelSlotsCount; ++j) {
+                    now += timer_wheel_t::CGranularityMs;
+                    wheel->template tick_force<tick_functor_t>(now);
+                }
+            }
+        }, CTimersCount);
+    }
+
+    {
+        skl::SklRand rand{};
+        for (auto& delay : g_delays) {
+            delay = rand.next_range(1U, CTimersCount);
+        }
+
+        auto wheel   = std::make_unique<hier_wheel_t>();
+        u64  expired = 0U;
+        auto on_expired = [&expired](skl::htimer_wheel::handle_t) noexcept { ++expired; };
+
+        runner.run("HierarchicalWheel/insert_cancel", [&wheel](u64 f_iterations) noexcept {
+            const u64 now = wheel->now();
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                const auto handle = skl::htimer_wheel::make_handle(u32(i & CTimersMask), 1U);
+                wheel->insert(handle, now + g_delays[i & CTimersMask]);
+                skl::bench::do_not_optimize(wheel->cancel(handle));
+            }
+        });
+
+        runner.run("HierarchicalWheel/insert_expire_4096", [&wheel, &on_expired](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                const u64 now = wheel->now();
+                for (u32 j = 0U; j < CTimersCount; ++j) {
+                    wheel->insert(skl::htimer_wheel::make_handle(j, 1U), now + g_delays[j]);
+                }
+                (void)wheel->advance(now + CTimersCount, on_expired);
+            }
+        }, CTimersCount);
+
+        skl::bench::do_not_optimize(expired);
+    }
+
+    {
+        skl::SklRand     rand{};
+        std::vector<u32> expiry(CLargeTimersCount);
+        for (auto& tick : expiry) {
+            tick = rand.next_range(1U, CLargeMaxTick);
+        }
+
+        u64  expired    = 0U;
+        auto on_expired = [&expired](skl::htimer_wheel::handle_t) noexcept { ++expired; };
+
+        //1M timers: insert all, cancel every 2nd, expire the rest (incl. cascades)
+        runner.run("HierarchicalWheel/insert_cancel_half_expire_1M", [&expiry, &on_expired](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i) {
+                auto      wheel = std::make_unique<hier_wheel_t>();
+                const u64 now   = wheel->now();
+                for (u32 j = 0U; j < CLargeTimersCount; ++j) {
+                    wheel->insert(skl::htimer_wheel::make_handle(j, 1U), now + expiry[j]);
+                }
+                for (u32 j = 0U; j < CLargeTimersCount; j += 2U) {
+                    skl::bench::do_not_optimize(wheel->cancel(skl::htimer_wheel::make_handle(j, 1U)));
+                }
+                (void)wheel->advance(now + CLargeMaxTick, on_expired);
+            }
+        }, CLargeTimersCount);
+
+        skl::bench::do_not_optimize(expired);
+    }
+
+    {
+        //Main thread schedule + cancel with ~50k live timers while the timer thread runs at 250hz
+        skl::SklRand rand{};
+        for (auto& delay : g_delays) {
+            delay = rand.next_range(4U, 1000U);
+        }
+
+        auto service = std::make_unique<service_t>();
+        if (service->start().is_failure()) {
+            (void)fprintf(stderr, "HTimerWheel: failed to start the timer thread!\n");
+            return 1;
+        }
+
+        u64  fired   = 0U;
+        auto handler = [&fired](skl::htimer_wheel::handle_t, u64) noexcept { ++fired; };
+
+        //Each slot holds one live timer, rescheduled (cancel + schedule) round robin
+        std::vector<skl::htimer_wheel::handle_t> live(CLiveTimersCount);
+        u64                                      now = skl::get_current_epoch_time();
+        for (u32 i = 0U; i < CLiveTimersCount; ++i) {
+            live[i] = service->schedule(g_delays[i & CTimersMask], 0U, now);
+        }
+        (void)service->update(handler);
+
+        u64 slot = 0U;
+        runner.run("HTimerWheel/reschedule_50k_live_timer_thread", [&](u64 f_iterations) noexcept {
+            for (u64 i = 0U; i < f_iterations; ++i, ++slot) {
+                if (0U == (slot & 255U)) {
+                    now = skl::get_current_epoch_time();
+                    (void)service->update(handler);
+                }
+
+                auto& handle = live[slot % CLiveTimersCount];
+                skl::bench::do_not_optimize(service->cancel(handle));
+                handle = service->schedule(g_delays[slot & CTimersMask], 0U, now);
+            }
+        });
+
+        (void)service->stop();
+        skl::bench::do_not_optimize(fired);
+    }
+
+    const int exit_code = runner.finish();
+    (void)skl::skl_core_deinit();
+    return exit_code;
+}
@@ -0,0 +1,60 @@
+#
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Balan Narcis (balannarcis96@gmail.com)
+#
+include_guard()
+
+# Note: Benchmarks link against "libskl-core-bench" (same preset/tuning as the dev lib, never sanitized)
+function( skl_AddCoreBench
+          DIRECTORY )
+
+    if(NOT TARGET libskl-core-bench)
+        message(FATAL_ERROR "Benchmarks require the libskl-core-bench target!")
+    endif()
+
+    get_filename_component(_DIRECTORY_NAME "${DIRECTORY}" NAME)
+    set(_TARGET_NAME "skl-core-bench-${_DIRECTORY_NAME}")
+    file(GLOB _SOURCE_FILES "${DIRECTORY}/*.cpp")
+
+    add_executable(
+        ${_TARGET_NAME}
+        ${_SOURCE_FILES}
+    )
+
+    target_include_directories(${_TARGET_NAME} PUBLIC ${DIRECTORY})
+    target_include_directories(${_TARGET_NAME} PUBLIC "${PROJECT_SOURCE_DIR}/bench/include")
+
+    # Link skylake core
+    target_link_libraries(${_TARGET_NAME} PUBLIC "libskl-core-bench")
+
+    set_target_properties(${_TARGET_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bin/skl-core-benchmarks")
+
+    # Collect for the run target
+    set_property(GLOBAL APPEND PROPERTY SKL_CORE_BENCH_TARGETS ${_TARGET_NAME})
+
+endfunction()
+
+# Add the "skl-core-run-benchmarks" target, runs all benchmarks added so far and writes
+# one json file per benchmark into ${SKL_CORE_BENCH_RESULTS_DIR}
+function( skl_AddCoreBenchRunTarget )
+
+    get_property(_BENCH_TARGETS GLOBAL PROPERTY SKL_CORE_BENCH_TARGETS)
+
+    set(_COMMANDS "")
+    foreach(_BENCH_TARGET IN LISTS _BENCH_TARGETS)
+        list(APPEND _COMMANDS
+            COMMAND $<TARGET_FILE:${_BENCH_TARGET}>
+                    --json "${SKL_CORE_BENCH_RESULTS_DIR}/${_BENCH_TARGET}.json"
+                    --tag "${SKL_CORE_BENCH_TAG}")
+    endforeach()
+
+    add_custom_target(
+        skl-core-run-benchmarks
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${SKL_CORE_BENCH_RESULTS_DIR}"
+        ${_COMMANDS}
+        DEPENDS ${_BENCH_TARGETS}
+        USES_TERMINAL
+        VERBATIM
+    )
+
+endfunction()
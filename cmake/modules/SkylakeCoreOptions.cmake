@@ -21,8 +21,14 @@ set(SKL_LOG_LEVEL_DEV "0x3F" CACHE STRING "[CORE] Log level mask for DEV build (
 # Misc
 set(SKL_CORE_ENABLE_SANITIZATION ON CACHE BOOL "[DEV/STAGING] Enable address sanitization")
 set(SKL_CORE_ENABLE_TESTS ON CACHE BOOL "[TopLevel] Enable tests")
+set(SKL_CORE_ENABLE_TOOLS ON CACHE BOOL "[TopLevel] Enable tools")
+set(SKL_CORE_ENABLE_BENCHMARKS ON CACHE BOOL "[TopLevel] Enable benchmarks")
+set(SKL_CORE_BENCH_PRESET "" CACHE STRING "[TopLevel] Tuning preset for the benchmarks lib (empty = default preset)")
+set(SKL_CORE_BENCH_RESULTS_DIR "${CMAKE_BINARY_DIR}/bench-results" CACHE PATH "[TopLevel] Output directory for the benchmarks json results")
+set(SKL_CORE_BENCH_TAG "" CACHE STRING "[TopLevel] Tag stored in the benchmarks json results (eg. commit hash)")
 set(SKL_CORE_ADD_PRESETS ON CACHE BOOL "Add core presets")
 set(SKL_CORE_NO_EXCEPTIONS OFF CACHE BOOL "Disable exceptions support")
+set(SKL_CORE_SIMD_RUNTIME_DISPATCH OFF CACHE BOOL "[CORE] Select the SIMD kernels (SSE2/AVX2/AVX-512) at runtime by the host cpu features")
 
 # Set properties options
 set_property(CACHE SKL_BUILD_TYPE PROPERTY STRINGS ${SKL_CORE_BUILD_TYPE_OPTIONS}) # Build type
@@ -34,4 +40,6 @@ if("${SKL_BUILD_TYPE}" STREQUAL "SHIPPING")
 endif()
 if(NOT PROJECT_IS_TOP_LEVEL)
     set(SKL_CORE_ENABLE_TESTS OFF CACHE BOOL "" FORCE)
+    set(SKL_CORE_ENABLE_TOOLS OFF CACHE BOOL "" FORCE)
+    set(SKL_CORE_ENABLE_BENCHMARKS OFF CACHE BOOL "" FORCE)
 endif()
@@ -0,0 +1,26 @@
+#
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2025 Balan Narcis (balannarcis96@gmail.com)
+#
+include_guard()
+
+function( skl_AddCoreTool
+          DIRECTORY )
+
+    get_filename_component(_DIRECTORY_NAME "${DIRECTORY}" NAME)
+    set(_TARGET_NAME "skl-${_DIRECTORY_NAME}")
+    file(GLOB _SOURCE_FILES "${DIRECTORY}/*.cpp")
+
+    add_executable(
+        ${_TARGET_NAME}
+        ${_SOURCE_FILES}
+    )
+
+    target_include_directories(${_TARGET_NAME} PUBLIC ${DIRECTORY})
+
+    # Link skylake core
+    target_link_libraries(${_TARGET_NAME} PUBLIC "libskl-core-dev")
+
+    set_target_properties(${_TARGET_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bin/skl-core-tools")
+
+endfunction()
@@ -0,0 +1,118 @@
+//!
+//! \file skl_slogger_binary
+//!
+//! \brief Serialized logger binary log file format and decoder
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include "skl_def"
+#include "skl_result"
+#include "skl_string_view"
+#include "skl_core_tuning"
+
+//! Binary log file layout:
+//!     File    := Segment+
+//!     Segment := [Entry::Segment][slogger_binary_segment_header_t] Entry*
+//!     Entry   := [Entry::Dictionary][u32 id][u32 length][string bytes]
+//!              | [Entry::Record][u16 size][u32 timestamp][u16 uid][u8 type][u16 line][u32 file name id][u32 fmt id][u16 args count][args]
+//!              | [Entry::RawRecord][u16 size][raw serialized record] (dictionary full)
+//! \remark Each segment has its own dictionary (ids start at 0), a segment is started on each open and file rotation
+//! \remark All values are in host form (same as the serialized records), decode on the same endianness
+namespace skl {
+//! Segment magic ("SLGB")
+constexpr u32 CSLoggerBinaryMagic = 0x42474C53U;
+
+//! Binary format version
+constexpr u16 CSLoggerBinaryVersion = 1U;
+
+//! Size of the record fields preceding the file name ([u32 timestamp][u16 uid][u8 type][u16 line])
+constexpr u32 CSLoggerBinaryRecordFixedSize = 4U + 2U + 1U + 2U;
+
+//! Max count of interned strings per segment
+constexpr u32 CSLoggerBinaryDictionaryMaxEntries = 8192U;
+
+//! Max bytes of interned strings per segment
+constexpr u64 CSLoggerBinaryDictionaryMaxBytes = 1024U * 1024U;
+
+//! Binary log entry kind
+enum class ESLoggerBinaryEntry : u8 {
+    Segment    = 1U, //!< Segment start, resets the dictionary
+    Dictionary = 2U, //!< Interned string
+    Record     = 3U, //!< Record with interned file name and fmt string
+    RawRecord  = 4U  //!< Raw serialized record
+};
+
+//! Segment header
+struct slogger_binary_segment_header_t {
+    u32 m_magic;          //!< CSLoggerBinaryMagic
+    u16 m_version;        //!< CSLoggerBinaryVersion
+    u16 m_reserved;       //!< 0
+    u64 m_start_epoch_ms; //!< Epoch time the segment was started
+};
+static_assert(sizeof(slogger_binary_segment_header_t) == 16U);
+
+//! Binary log decoder counters
+struct slogger_binary_decoder_stats_t {
+    u64 m_segments_count   = 0U; //!< Segments decoded
+    u64 m_dictionary_count = 0U; //!< Dictionary entries loaded
+    u64 m_records_count    = 0U; //!< Records decoded
+    u64 m_malformed_count  = 0U; //!< Malformed entries (decoding stops at the first one)
+};
+
+//! Replays a binary log file through the serialized logger back-end
+class SLoggerBinaryDecoder {
+public:
+    //! Called for each decoded record, \p f_text is valid only for the duration of the call
+    using record_handler_t = void (*)(void* f_context, skl_string_view f_text) noexcept;
+
+    SLoggerBinaryDecoder() noexcept = default;
+    ~SLoggerBinaryDecoder() noexcept;
+
+    SKL_NO_MOVE_OR_COPY(SLoggerBinaryDecoder);
+
+    //! [Init] Map the given binary log file
+    //! \returns SKL_ERR_STATE if already open
+    //! \returns SKL_ERR_FILE if the file could not be opened or mapped
+    //! \returns SKL_ERR_CORRUPT if the file does not start with a segment
+    //! \returns SKL_ERR_ALLOC if the decoding buffers could not be allocated
+    [[nodiscard]] skl_status open(const char* f_file_path) noexcept;
+
+    //! [Shutdown] Unmap the file and free the decoding buffers
+    void close() noexcept;
+
+    //! Is the decoder open
+    [[nodiscard]] bool is_open() const noexcept {
+        return nullptr != m_buffers;
+    }
+
+    //! [Getter] Get the decoder counters
+    [[nodiscard]] const slogger_binary_decoder_stats_t& stats() const noexcept {
+        return m_stats;
+    }
+
+    //! Decode all records and call \p f_functor(skl_string_view) for each
+    //! \returns the count of decoded records
+    //! \returns SKL_ERR_STATE if not open
+    //! \returns SKL_ERR_CORRUPT if a malformed entry was found (records before it were decoded)
+    template <bool _AllowColors = true, typename _Functor>
+    [[nodiscard]] skl_result<u64> decode(_Functor& f_functor) noexcept {
+        return decode_internal(_AllowColors, &invoke_handler<_Functor>, &f_functor);
+    }
+
+private:
+    template <typename _Functor>
+    static void invoke_handler(void* f_context, skl_string_view f_text) noexcept {
+        (*static_cast<_Functor*>(f_context))(f_text);
+    }
+
+    [[nodiscard]] skl_result<u64> decode_internal(bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept;
+
+private:
+    const byte*                    m_file      = nullptr; //!< Mapped file
+    u64                            m_file_size = 0U;      //!< File size
+    byte*                          m_buffers   = nullptr; //!< Dictionary + record reconstruction buffer
+    slogger_binary_decoder_stats_t m_stats{};             //!< Counters
+};
+} // namespace skl
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "skl_stream"
+#include "skl_atomic"
 #include "skl_string_view"
 #include "skl_traits/is_cstring"
 #include "skl_traits/rm_all_cv"
@@ -23,7 +24,47 @@ constexpr u64 CSerializedLoggerFixedHeaderSize = 4U  //Timestamp (relative to th
                                                + 2U  //Line Number
                                                + 2U; //Params Count
 
+constexpr u64 CSerializedLoggerSiteHeaderSize = 4U  //Timestamp
+                                              + 2U  //UID
+                                              + 1U  //Type | CSLoggerSiteRecordFlag
+                                              + 4U  //Site id
+                                              + 2U; //Params Count
+
 static_assert(CMaxSerializedLoggerHeaderSize >= CSerializedLoggerFixedHeaderSize);
+static_assert(CSerializedLoggerSiteHeaderSize <= (CSerializedLoggerFixedHeaderSize + (sizeof(skl_stream::str_len_prefix_t) * 2U)));
+
+//! Log call site id, resolved by the back-end into the file name, fmt string and line number
+using slogger_site_id_t = u32;
+
+//! Call site not registered yet
+constexpr slogger_site_id_t CSLoggerNoSiteId = 0U;
+
+//! Call site could not be registered (registry full), the file name and fmt string are serialized inline
+constexpr slogger_site_id_t CSLoggerInlineSiteId = 0xFFFFFFFFU;
+
+//! Set on the record type when the record carries a site id instead of the line number, file name and fmt string
+constexpr u8 CSLoggerSiteRecordFlag = 0x80U;
+
+//! Registered log call site
+struct slogger_site_t {
+    skl_string_view m_file_name;   //!< Static storage
+    skl_string_view m_fmt_string;  //!< Static storage
+    u16             m_line_number; //!< Line number
+};
+
+//! Per call site id slot, the call site is identified by the instantiation (see SKL_LOG_SITE)
+template <typename _Site>
+struct slogger_site_slot_t {
+    static inline std::relaxed_value<slogger_site_id_t> s_id{CSLoggerNoSiteId};
+};
+
+//! [ThreadSafe] Register the call site owning \p f_slot (once), the strings must have static storage
+//! \returns the site id or CSLoggerInlineSiteId if the registry is full
+[[nodiscard]] SKL_NOINLINE slogger_site_id_t skl_register_log_site(std::relaxed_value<slogger_site_id_t>& f_slot, u16 f_line_number, skl_string_view f_file_name, skl_string_view f_fmt_string) noexcept;
+
+//! [ThreadSafe] Get the registered call site
+//! \returns nullptr if \p f_site_id is not a registered site id
+[[nodiscard]] const slogger_site_t* skl_get_log_site(slogger_site_id_t f_site_id) noexcept;
 
 enum ELogParamType : u8 {
     None,
@@ -55,47 +96,68 @@ struct SKLSerializedLoggerFrontEnd {
     SKLSerializedLoggerFrontEnd& operator=(SKLSerializedLoggerFrontEnd&&)      = delete;
 
     //! Submit new log
-    template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, u64 _FormatStringSize, typename... _Args>
+    template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, typename _Site, u64 _FormatStringSize, typename... _Args>
     static void log(skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
         //Check that the Fixed hader, file name and fmt string can fit in the serialized logging front end buffer
         constexpr u64 _MinRequiredSize = CSerializedLoggerFixedHeaderSize + _FileNameLength + _FormatStringSize + (sizeof(skl_stream::str_len_prefix_t) * 2U);
         static_assert(CSerializedLoggerFrontEndBufferMinSize >= _MinRequiredSize);
 
-        auto& log_buffer = skl_begin_log();
-        if (serialize<_Type>(log_buffer, _LineNumber, f_file_name, f_fmt, f_args...)) [[likely]] {
+        const auto site_id    = get_site_id<_Site>(_LineNumber, f_file_name, f_fmt);
+        auto&      log_buffer = skl_begin_log();
+        if (serialize<_Type>(log_buffer, site_id, _LineNumber, f_file_name, f_fmt, f_args...)) [[likely]] {
             [[likely]] skl_commit_log();
         }
     }
 
     //! Submit new log to specific sink
-    template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, u64 _FormatStringSize, typename... _Args>
+    template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, typename _Site, u64 _FormatStringSize, typename... _Args>
     static void log_specific(slogger_sink_id_t f_sink_id, skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
         //Check that the Fixed hader, file name and fmt string can fit in the serialized logging front end buffer
         constexpr u64 _MinRequiredSize = CSerializedLoggerFixedHeaderSize + _FileNameLength + _FormatStringSize + (sizeof(skl_stream::str_len_prefix_t) * 2U);
         static_assert(CSerializedLoggerFrontEndBufferMinSize >= _MinRequiredSize);
 
-        auto& log_buffer = skl_begin_log(f_sink_id);
-        if (serialize<_Type>(log_buffer, _LineNumber, f_file_name, f_fmt, f_args...)) [[likely]] {
+        const auto site_id    = get_site_id<_Site>(_LineNumber, f_file_name, f_fmt);
+        auto&      log_buffer = skl_begin_log(f_sink_id);
+        if (serialize<_Type>(log_buffer, site_id, _LineNumber, f_file_name, f_fmt, f_args...)) [[likely]] {
             [[likely]] skl_commit_log(f_sink_id);
         }
     }
 
 private:
+    //! Get the id of the call site, registers the site on first use
+    template <typename _Site, u64 _FormatStringSize>
+    [[nodiscard]] SKL_FORCEINLINE static slogger_site_id_t get_site_id(u16 f_line_number, skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize]) noexcept {
+        auto&      slot    = slogger_site_slot_t<_Site>::s_id;
+        const auto site_id = slot.load_acquire();
+        if (CSLoggerNoSiteId == site_id) [[unlikely]] {
+            return skl_register_log_site(slot, f_line_number, f_file_name, skl_string_view::exact_cstr(f_fmt));
+        }
+        return site_id;
+    }
+
     //! Serialize the raw log data into the given stream if
     //! \note Protocol: Skylake Protocol
     template <ELogType _Type, u64 _FormatStringSize, typename... _Args>
-    [[nodiscard]] static bool serialize(skl_stream& f_stream, u16 f_line_number, skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
-        //Log Type (We are guaranteed to have space for the type)
-        f_stream.write<u8>(u8(_Type));
+    [[nodiscard]] static bool serialize(skl_stream& f_stream, slogger_site_id_t f_site_id, u16 f_line_number, skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
+        if (CSLoggerInlineSiteId != f_site_id) [[likely]] {
+            //Log Type + site flag (We are guaranteed to have space for the type)
+            f_stream.write<u8>(u8(_Type) | CSLoggerSiteRecordFlag);
+
+            //Site id, the back-end resolves the line number, file name and fmt string (We are guaranteed to have space for the site id)
+            f_stream.write<slogger_site_id_t>(f_site_id);
+        } else {
+            //Log Type (We are guaranteed to have space for the type)
+            f_stream.write<u8>(u8(_Type));
 
-        //Line number (We are guaranteed to have space for the line number)
-        f_stream.write<u16>(f_line_number);
+            //Line number (We are guaranteed to have space for the line number)
+            f_stream.write<u16>(f_line_number);
 
-        //File name (We are guaranteed to have space for the file name string)
-        f_stream.write_length_prefixed_str_checked(f_file_name);
+            //File name (We are guaranteed to have space for the file name string)
+            f_stream.write_length_prefixed_str_checked(f_file_name);
 
-        //Format string (We are guaranteed to have space for the fmt string)
-        f_stream.write_length_prefixed_str_checked(skl_string_view::exact_cstr(f_fmt));
+            //Format string (We are guaranteed to have space for the fmt string)
+            f_stream.write_length_prefixed_str_checked(skl_string_view::exact_cstr(f_fmt));
+        }
 
         //Write Params if any (We are guaranteed to have space for the params count)
         f_stream.write<u16>(static_cast<u16>(sizeof...(_Args)));
@@ -206,13 +268,13 @@ private:
 };
 
 //! Submit a serialized log
-template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, u64 _FormatStringSize, typename... _Args>
+template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, typename _Site, u64 _FormatStringSize, typename... _Args>
 SKL_NOINLINE inline void skl_log(skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
-    SKLSerializedLoggerFrontEnd::log<_Type, _FileNameLength, _LineNumber>(f_file_name, f_fmt, f_args...);
+    SKLSerializedLoggerFrontEnd::log<_Type, _FileNameLength, _LineNumber, _Site>(f_file_name, f_fmt, f_args...);
 }
 //! Submit a serialized log to a specific sink
-template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, u64 _FormatStringSize, typename... _Args>
+template <ELogType _Type, u64 _FileNameLength, u16 _LineNumber, typename _Site, u64 _FormatStringSize, typename... _Args>
 SKL_NOINLINE inline void skl_log_specific(slogger_sink_id_t f_sink_id, skl_string_view f_file_name, const char (&f_fmt)[_FormatStringSize], _Args... f_args) noexcept {
-    SKLSerializedLoggerFrontEnd::log_specific<_Type, _FileNameLength, _LineNumber>(f_sink_id, f_file_name, f_fmt, f_args...);
+    SKLSerializedLoggerFrontEnd::log_specific<_Type, _FileNameLength, _LineNumber, _Site>(f_sink_id, f_file_name, f_fmt, f_args...);
 }
 } // namespace skl
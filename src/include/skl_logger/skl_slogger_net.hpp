@@ -0,0 +1,117 @@
+//!
+//! \file skl_slogger_net
+//!
+//! \brief Serialized logger network sink wire format and collector
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#pragma once
+
+#include "skl_ip"
+#include "skl_def"
+#include "skl_result"
+#include "skl_socket"
+#include "skl_string_view"
+#include "skl_core_tuning"
+
+namespace skl {
+//! Datagram magic ("SL")
+constexpr u16 CSLoggerNetDatagramMagic = 0x4C53U;
+
+//! Wire protocol version
+constexpr u8 CSLoggerNetProtocolVersion = 1U;
+
+//! Datagram header
+//! \remark Followed by m_records_count x [u16 record length][raw serialized record (unformatted)]
+//! \remark All fields are in host form (same as the serialized records), the collector must run on the same endianness
+struct slogger_net_datagram_header_t {
+    u16 m_magic;         //!< CSLoggerNetDatagramMagic
+    u8  m_version;       //!< CSLoggerNetProtocolVersion
+    u8  m_records_count; //!< Count of records in this datagram
+    u32 m_sequence;      //!< Sender datagram sequence number (gaps = lost datagrams)
+};
+static_assert(sizeof(slogger_net_datagram_header_t) == 8U);
+
+//! Record length prefix type
+using slogger_net_record_len_t = u16;
+
+//! Max size of a datagram, a record larger than the max datagram size is sent alone (ip fragmented)
+constexpr u64 CSLoggerNetMaxDatagramCapacity = sizeof(slogger_net_datagram_header_t) + sizeof(slogger_net_record_len_t) + CSerializedLoggerThreadBufferSize;
+static_assert(CSLoggerNetMaxDatagramCapacity <= 0xFFFFU);
+
+//! Network logger collector counters
+struct slogger_net_collector_stats_t {
+    u64 m_datagrams_count      = 0U; //!< Datagrams received
+    u64 m_records_count        = 0U; //!< Records decoded
+    u64 m_bytes_count          = 0U; //!< Bytes received
+    u64 m_lost_datagrams_count = 0U; //!< Datagrams lost (sequence gaps)
+    u64 m_malformed_count      = 0U; //!< Malformed datagrams dropped
+};
+
+//! [Net] Receives the network sink datagrams and formats the raw records on the receiving side
+class SLoggerNetCollector {
+public:
+    //! Called for each decoded record, \p f_text is valid only for the duration of the call
+    using record_handler_t = void (*)(void* f_context, skl_string_view f_text) noexcept;
+
+    //! Count of datagrams received with one recvmmsg call
+    static constexpr u32 CReceiveBatch = 32U;
+
+    SLoggerNetCollector() noexcept = default;
+    ~SLoggerNetCollector() noexcept;
+
+    SKL_NO_MOVE_OR_COPY(SLoggerNetCollector);
+
+    //! [Init] Open the udp socket and bind it to \p f_address : \p f_port (0 = any free port, see port())
+    //! \returns SKL_ERR_STATE if already open
+    //! \returns SKL_ERR_ALLOC if the receive buffers could not be allocated
+    //! \returns SKL_ERR_PORT if the socket could not be created or bound
+    [[nodiscard]] skl_status open(ipv4_addr_t f_address, net_port_t f_port) noexcept;
+
+    //! [Shutdown] Close the socket and free the receive buffers
+    void close() noexcept;
+
+    //! Is the collector open
+    [[nodiscard]] bool is_open() const noexcept {
+        return is_socket_valid(m_socket);
+    }
+
+    //! [Getter] Get the bound port (host form)
+    [[nodiscard]] net_port_t port() const noexcept {
+        return m_port;
+    }
+
+    //! [Getter] Get the collector counters
+    [[nodiscard]] const slogger_net_collector_stats_t& stats() const noexcept {
+        return m_stats;
+    }
+
+    //! Wait up to \p f_timeout_ms for datagrams, decode all received records and call \p f_functor(skl_string_view) for each
+    //! \returns the count of decoded records
+    //! \returns SKL_ERR_STATE if not open
+    //! \returns SKL_ERR_RX on socket errors
+    template <bool _AllowColors = true, typename _Functor>
+    [[nodiscard]] skl_result<u32> poll(u32 f_timeout_ms, _Functor& f_functor) noexcept {
+        return poll_internal(f_timeout_ms, _AllowColors, &invoke_handler<_Functor>, &f_functor);
+    }
+
+private:
+    template <typename _Functor>
+    static void invoke_handler(void* f_context, skl_string_view f_text) noexcept {
+        (*static_cast<_Functor*>(f_context))(f_text);
+    }
+
+    [[nodiscard]] skl_result<u32> poll_internal(u32 f_timeout_ms, bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept;
+
+    //! Decode all records in the given datagram
+    [[nodiscard]] u32 decode_datagram(byte* f_datagram, u32 f_size, bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept;
+
+private:
+    socket_t                      m_socket{CInvalidSocket}; //!< Udp socket
+    net_port_t                    m_port{0U};               //!< Bound port
+    bool                          m_has_sequence{false};    //!< Has received any datagram
+    u32                           m_next_sequence{0U};      //!< Next expected datagram sequence
+    byte*                         m_buffers{nullptr};       //!< CReceiveBatch x CSLoggerNetMaxDatagramCapacity receive buffers
+    slogger_net_collector_stats_t m_stats{};                //!< Counters
+};
+} // namespace skl
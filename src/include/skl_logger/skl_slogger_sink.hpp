@@ -7,13 +7,17 @@
 //!
 #pragma once
 
+#include "skl_ip"
 #include "skl_status"
 #include "skl_assert"
+#include "skl_pair"
 #include "skl_logger/skl_slogger_shared.hpp"
 
 namespace skl {
 struct skl_stream;
 struct LoggerFileHandleSink;
+struct LoggerFileSink;
+struct LoggerNetworkSink;
 
 //! Custom logger sink base
 struct SLoggerSink {
@@ -62,14 +66,83 @@ private:
     const bool              m_has_begin; //!< Requires begin_log() called
 
     friend LoggerFileHandleSink;
+    friend LoggerFileSink;
+    friend LoggerNetworkSink;
+};
+
+//! File logger sink output format
+enum class ESLoggerFileSinkFormat : u8 {
+    Text,  //!< Records are formatted on the logging thread
+    Binary //!< Raw records with interned file names and fmt strings, no formatting (see skl_slogger_binary)
 };
 
 //! File logger sink config
 struct slogger_file_sink_config_t {
+    const char* m_file_path          = nullptr; //!< Log file path (copied), rotated files are renamed to "<path>.<N>" (N continues after the existing ones)
+    u64         m_rotate_size_bytes  = 0U;      //!< Rotate once the file reaches this size (0 = never)
+    u32         m_rotate_interval_ms = 0U;      //!< Rotate once the file is older than this (0 = never)
+    u32         m_flush_interval_ms  = 100U;    //!< Max time formatted records wait in a partially filled buffer
+    bool        m_use_direct_io      = false;   //!< Write with O_DIRECT (falls back to buffered I/O if not supported by the fs)
+    bool        m_truncate           = false;   //!< Truncate the file on open (default appends)
+
+    //! Output format, binary files are decoded with SLoggerBinaryDecoder (skl-slogger-decoder tool)
+    //! \remark In binary mode, appending is only valid to a binary log file (each open starts a new segment)
+    ESLoggerFileSinkFormat m_format = ESLoggerFileSinkFormat::Text;
+};
+
+//! File logger sink counters
+struct slogger_file_sink_stats_t {
+    u64  m_records_count          = 0U;    //!< Records formatted into the sink buffers
+    u64  m_dropped_count          = 0U;    //!< Records dropped, all buffers were pending write
+    u64  m_written_bytes          = 0U;    //!< Bytes written to disk
+    u64  m_flush_count            = 0U;    //!< Count of write batches (writev/pwrite calls sequence)
+    u64  m_flush_latency_total_ns = 0U;    //!< Sum of write batch latencies
+    u64  m_flush_latency_max_ns   = 0U;    //!< Max write batch latency
+    u64  m_rotations_count        = 0U;    //!< Count of file rotations
+    u64  m_write_errors_count     = 0U;    //!< Count of failed writes
+    u64  m_interned_count         = 0U;    //!< [Binary] Count of strings written to the dictionaries
+    bool m_is_direct_io           = false; //!< Is the file written with O_DIRECT
 };
 
 //! Network logger sink config
 struct slogger_net_sink_config_t {
+    ipv4_addr_t m_address           = CIpLoopback; //!< Collector address (host form)
+    net_port_t  m_port              = 0U;          //!< Collector port (host form)
+    u16         m_max_datagram_size = 1472U;       //!< Max datagram size (default: 1500 MTU - IPv4 header - UDP header)
+    u32         m_flush_interval_ms = 10U;         //!< Max time records wait in a partially filled datagram
+};
+
+//! Network logger sink counters
+struct slogger_net_sink_stats_t {
+    u64 m_records_count   = 0U; //!< Records packed into datagrams
+    u64 m_dropped_count   = 0U; //!< Records dropped, all datagrams were pending send
+    u64 m_datagrams_count = 0U; //!< Datagrams sent
+    u64 m_sent_bytes      = 0U; //!< Bytes sent
+    u64 m_send_calls      = 0U; //!< Count of sendmmsg calls
+    u64 m_send_errors     = 0U; //!< Count of datagrams that failed to send
+};
+
+//! What the producer does when its async ring has no space for the record
+enum class ESLoggerAsyncOverflowPolicy : u8 {
+    Drop, //!< Drop the record and count it (never blocks the producer)
+    Block //!< Spin until the back-end thread frees enough space
+};
+
+//! Async logger config
+struct slogger_async_config_t {
+    ESLoggerAsyncOverflowPolicy m_overflow_policy = ESLoggerAsyncOverflowPolicy::Drop; //!< Producer policy on full ring
+    pair<i16, i16>              m_cpu_affinity{-1, -1};                                 //!< Back-end thread affinity (see SKLThread::create)
+    u32                         m_idle_sleep_us = 250U;                                 //!< Back-end thread sleep time when all rings are empty
+};
+
+//! Async logger counters (aggregated over all producers)
+struct slogger_async_stats_t {
+    u64 m_submitted_count = 0U; //!< Records copied into the producer rings
+    u64 m_submitted_bytes = 0U; //!< Bytes copied into the producer rings
+    u64 m_processed_count = 0U; //!< Records sunk by the back-end thread
+    u64 m_dropped_count   = 0U; //!< Records dropped on full ring [Drop]
+    u64 m_blocked_count   = 0U; //!< Records that had to wait for ring space [Block]
+    u32 m_producers_count = 0U; //!< Currently registered producer threads
 };
 
 //! Manage SLogger sinks
@@ -92,11 +165,44 @@ struct SLoggerSinkManager {
     [[nodiscard]] static skl_status register_custom_sink(SLoggerSink* f_sink) noexcept;
 
     //! Setup the network sink
+    //! \remark Records are not formatted, the raw serialized records are packed into datagrams of at most
+    //!         \p f_config.m_max_datagram_size bytes (see skl_slogger_net), a dedicated sender thread sends them with sendmmsg
+    //! \remark Use SLoggerNetCollector to receive and format the records
+    //! \remark The logging thread never waits for the socket, records are dropped if all datagrams are pending send
+    //! \returns SKL_ERR_PARAMS if \p f_config.m_port is 0 or \p f_config.m_max_datagram_size is out of range
+    //! \returns SKL_ERR_STATE if the network sink is already open
+    //! \returns SKL_ERR_PORT if the udp socket could not be created
+    //! \returns SKL_ERR_ALLOC if the datagram buffers could not be allocated
+    //! \returns SKL_ERR_THREAD if the sender thread failed to start
     [[nodiscard]] static skl_status setup_network_sink(const slogger_net_sink_config_t& f_config) noexcept;
 
+    //! [Shutdown] Send all pending records, stop the sender thread and close the network sink
+    //! \remark Records sunk after this call are dropped until setup_network_sink(...) is called again
+    //! \returns SKL_OK_REDUNDANT if the network sink is not open
+    [[nodiscard]] static skl_status close_network_sink() noexcept;
+
+    //! [ThreadSafe][KPI] Get the network sink counters
+    [[nodiscard]] static slogger_net_sink_stats_t get_network_sink_stats() noexcept;
+
     //! Setup the file sink
+    //! \remark Records are formatted on the logging thread into large page aligned buffers,
+    //!         a dedicated writer thread writes the filled buffers (writev or pwrite for O_DIRECT) and rotates the file
+    //! \remark The logging thread never waits for disk I/O, records are dropped if all buffers are pending write
+    //! \returns SKL_ERR_PARAMS if \p f_config.m_file_path is nullptr or too long
+    //! \returns SKL_ERR_STATE if the file sink is already open
+    //! \returns SKL_ERR_FILE if the file could not be opened
+    //! \returns SKL_ERR_ALLOC if the buffers could not be allocated
+    //! \returns SKL_ERR_THREAD if the writer thread failed to start
     [[nodiscard]] static skl_status setup_file_sink(const slogger_file_sink_config_t& f_config) noexcept;
 
+    //! [Shutdown] Flush all buffered records, stop the writer thread and close the file sink
+    //! \remark Records sunk after this call are dropped until setup_file_sink(...) is called again
+    //! \returns SKL_OK_REDUNDANT if the file sink is not open
+    [[nodiscard]] static skl_status close_file_sink() noexcept;
+
+    //! [ThreadSafe][KPI] Get the file sink counters
+    [[nodiscard]] static slogger_file_sink_stats_t get_file_sink_stats() noexcept;
+
     //! Setup the file handle sink
     //! \returns SKL_ERR_PARAMS if \p f_file_handle is nullptr
     [[nodiscard]] static skl_status setup_file_handle_sink(void* f_file_handle) noexcept;
@@ -104,5 +210,23 @@ struct SLoggerSinkManager {
     //! Set the current sink
     //! \returns SKL_ERR_PARAMS if \p f_id is out of range
     [[nodiscard]] static skl_status set_current_sink(slogger_sink_id_t f_id) noexcept;
+
+    //! [Init] Start the async logger back-end thread
+    //! \remark While running, committing a log only copies the serialized record into the calling thread's ring,
+    //!         the back-end thread drains all rings and calls the sink's end_and_sink_log(...)
+    //! \returns SKL_OK_REDUNDANT if already running
+    //! \returns SKL_ERR_THREAD if the back-end thread failed to start
+    [[nodiscard]] static skl_status start_async(const slogger_async_config_t& f_config) noexcept;
+
+    //! [Shutdown] Stop the async logger back-end thread, all records submitted before this call are sunk
+    //! \remark Threads logging concurrently with this call fall back to sinking on the calling thread
+    //! \returns SKL_OK_REDUNDANT if not running
+    [[nodiscard]] static skl_status stop_async() noexcept;
+
+    //! [ThreadSafe] Is the async logger back-end thread running
+    [[nodiscard]] static bool is_async() noexcept;
+
+    //! [ThreadSafe][KPI] Get the async logger counters
+    [[nodiscard]] static slogger_async_stats_t get_async_stats() noexcept;
 };
 } // namespace skl
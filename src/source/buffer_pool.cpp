@@ -1,14 +1,19 @@
 #include "skl_pool/buffer_pool"
+#include "skl_tls"
+#include "skl_atomic"
 #include "skl_vector"
+#include "skl_spin_lock"
 
 #if !SKL_BUILD_SHIPPING
 #    include <unordered_set>
 #endif
 
 namespace {
-//! Intrusive freelist node - embedded in free buffers (8 bytes)
+//! Intrusive freelist node - embedded in free buffers (24 bytes)
 struct free_node_t {
-    free_node_t* next;
+    free_node_t* next;        //!< Next node in the same batch
+    free_node_t* next_batch;  //!< [Batch head] Next batch in the central list
+    u32          batch_count; //!< [Batch head] Count of nodes in the batch
 };
 
 //! Buffer header - stored at start of allocated buffer (8 bytes)
@@ -28,71 +33,295 @@ static_assert(sizeof(buffer_header_t) == 8, "Header must be 8 bytes for alignmen
 } // namespace
 
 namespace {
-constexpr u8  CMinBucketIndex = 5u;                      //!< Minimum bucket index (5 for 32-byte buffers)
-constexpr u8  CMaxBucketIndex = 31u;                     //!< Maximum bucket index (31 for 2GB buffers)
-constexpr u8  CMaxBuckets     = CMaxBucketIndex + 1u;    //!< Total bucket indices
-constexpr u64 CMaxBufferSize  = 1u << CMaxBucketIndex;   //!< Maximum buffer size (2GB)
-constexpr u32 CHeaderSize     = sizeof(buffer_header_t); //!< Size of buffer header (8 bytes)
-constexpr u32 CMinBlockSize   = 1u << 21u;               //!< Minimum allocation block size (2Mb)
+constexpr u8  CMinBucketIndex      = 5u;                      //!< Minimum bucket index (5 for 32-byte buffers)
+constexpr u8  CMaxBucketIndex      = 31u;                     //!< Maximum bucket index (31 for 2GB buffers)
+constexpr u8  CMaxBuckets          = CMaxBucketIndex + 1u;    //!< Total bucket indices
+constexpr u64 CMaxBufferSize       = 1u << CMaxBucketIndex;   //!< Maximum buffer size (2GB)
+constexpr u32 CHeaderSize          = sizeof(buffer_header_t); //!< Size of buffer header (8 bytes)
+constexpr u32 CMinBlockSize        = 1u << 21u;               //!< Minimum allocation block size (2Mb)
+constexpr u32 CMagazineBatchBytes  = 1u << 16u;               //!< Bytes moved between a thread cache and the central list at once (64Kb)
+constexpr u32 CMagazineMaxBatch    = 64u;                     //!< Max buffers moved between a thread cache and the central list at once
+constexpr u64 CTaggedPointerMask   = (1ull << 48u) - 1u;      //!< Pointer bits of a tagged pointer (x86-64 canonical user space address)
+constexpr u32 CTaggedPointerTagBit = 48u;                     //!< First tag bit of a tagged pointer
 
 static_assert(CMaxBuckets <= 32u, "Cannot have more than 32 buckets");
 static_assert(sizeof(free_node_t) <= (1u << CMinBucketIndex), "Free node must fit in minimum buffer size");
 
-//! Global metadata pointer
-free_node_t* g_buffer_bucket_heads[CMaxBuckets] = {};
+//! Count of buffers per batch for the given bucket (batch = unit of transfer between a thread cache and the central list)
+[[nodiscard]] constexpr u32 bucket_batch_size(u32 f_bucket_index) noexcept {
+    const u32 buffer_size = 1u << f_bucket_index;
+    if (buffer_size >= CMagazineBatchBytes) {
+        return 1u;
+    }
+
+    const u32 count = CMagazineBatchBytes >> f_bucket_index;
+    return count > CMagazineMaxBatch ? CMagazineMaxBatch : count;
+}
+
+//! Pack a node pointer and an ABA tag into one word
+[[nodiscard]] SKL_FORCEINLINE u64 tagged_pointer_make(free_node_t* f_node, u64 f_tag) noexcept {
+    SKL_ASSERT(0u == (reinterpret_cast<u64>(f_node) & ~CTaggedPointerMask));
+    return reinterpret_cast<u64>(f_node) | (f_tag << CTaggedPointerTagBit);
+}
+
+[[nodiscard]] SKL_FORCEINLINE free_node_t* tagged_pointer_node(u64 f_tagged) noexcept {
+    return reinterpret_cast<free_node_t*>(f_tagged & CTaggedPointerMask);
+}
+
+[[nodiscard]] SKL_FORCEINLINE u64 tagged_pointer_tag(u64 f_tagged) noexcept {
+    return f_tagged >> CTaggedPointerTagBit;
+}
+
+//! Shared lock-free list of batches of one bucket (Treiber stack, the tag is bumped on each change to prevent ABA)
+struct SKL_CACHE_ALIGNED central_bucket_t {
+    std::relaxed_value<u64> head{0u}; //!< Tagged pointer to the first batch
+
+    //! [ThreadSafe] Push a chain of batches (linked by next_batch) to the list
+    void push(free_node_t* f_first, free_node_t* f_last) noexcept {
+        u64 expected = head.load_relaxed();
+        for (;;) {
+            f_last->next_batch = tagged_pointer_node(expected);
+            if (head.cas(tagged_pointer_make(f_first, tagged_pointer_tag(expected) + 1u), expected)) {
+                return;
+            }
+        }
+    }
+
+    //! [ThreadSafe] Pop one batch from the list
+    //! \returns nullptr if the list is empty
+    [[nodiscard]] free_node_t* pop() noexcept {
+        u64 expected = head.load_acquire();
+        for (;;) {
+            free_node_t* batch = tagged_pointer_node(expected);
+            if (nullptr == batch) {
+                return nullptr;
+            }
+
+            //The batch may be popped and reused concurrently, the read value is then discarded by the failing cas (buffers are never released while the pool is alive)
+            free_node_t* next = __atomic_load_n(&batch->next_batch, __ATOMIC_RELAXED);
+            if (head.cas_strong(tagged_pointer_make(next, tagged_pointer_tag(expected) + 1u), expected)) {
+                return batch;
+            }
+        }
+    }
+
+    //! Take all batches (no concurrent users)
+    [[nodiscard]] free_node_t* take_all() noexcept {
+        return tagged_pointer_node(head.exchange(0u));
+    }
+};
+
+//! Per thread, per bucket buffers cache
+struct magazine_t {
+    free_node_t* current       = nullptr; //!< Buffers to allocate from (free pushes here)
+    free_node_t* spare         = nullptr; //!< Full batch kept before spilling to the central list
+    u32          current_count = 0u;      //!< Count of buffers in current
+};
+
+//! Per bucket shared batches lists
+central_bucket_t g_buffer_bucket_central[CMaxBuckets] = {};
+
+//! Bumped on each destroy_pool(), invalidates all thread caches
+std::relaxed_value<u64> g_buffer_pool_generation{1u};
+
+#if defined(SKL_CORE_TESTING)
+//! [Testing] Count of buffers allocated from the system and not yet freed
+std::relaxed_value<u64> g_buffer_pool_system_buffers{0u};
+#endif
 
 #if !SKL_BUILD_SHIPPING
 //! [Debug] Track all currently allocated buffers for validation
 std::unordered_set<void*> g_allocated_buffers[CMaxBuckets];
+skl::spin_lock_t          g_allocated_buffers_lock;
 #endif
 } // namespace
 
 namespace {
-//! Slow path: Allocate a new buffer page and link all buffers into the freelist
-template <u32 BucketIndex>
-[[gnu::noinline]] void populate_bucket_with_buffers() noexcept {
-    static_assert(BucketIndex >= CMinBucketIndex && BucketIndex <= CMaxBucketIndex, "Invalid bucket index");
+struct BufferPoolThreadCache;
+
+//! Registry of the live thread caches, destroy_pool() flushes them all
+BufferPoolThreadCache* g_buffer_pool_caches{nullptr};
+skl::spin_lock_t       g_buffer_pool_caches_lock;
+
+//! Per thread front of the buffer pool
+struct BufferPoolThreadCache {
+    magazine_t             magazines[CMaxBuckets]{};
+    u64                    generation = g_buffer_pool_generation.load_relaxed(); //!< Pool generation the cached buffers belong to
+    BufferPoolThreadCache* prev       = nullptr;                                 //!< [Registry] Previous live cache
+    BufferPoolThreadCache* next       = nullptr;                                 //!< [Registry] Next live cache
+
+    //! Return all cached buffers to the central lists
+    void flush() noexcept {
+        if (generation != g_buffer_pool_generation.load_relaxed()) {
+            //The pool was destroyed, the cached buffers are gone
+            reset();
+            return;
+        }
+
+        for (u32 i = CMinBucketIndex; i <= CMaxBucketIndex; ++i) {
+            auto& magazine = magazines[i];
+            if (nullptr != magazine.current) {
+                magazine.current->batch_count = magazine.current_count;
+                g_buffer_bucket_central[i].push(magazine.current, magazine.current);
+            }
+            if (nullptr != magazine.spare) {
+                g_buffer_bucket_central[i].push(magazine.spare, magazine.spare);
+            }
+            magazine = {};
+        }
+    }
+
+    //! Drop all cached buffers
+    void reset() noexcept {
+        for (auto& magazine : magazines) {
+            magazine = {};
+        }
+        generation = g_buffer_pool_generation.load_relaxed();
+    }
 
-    constexpr u32 CBufferSize = 1u << BucketIndex;
-    static_assert(CBufferSize >= sizeof(free_node_t), "Buffer must fit free node");
+    BufferPoolThreadCache() noexcept {
+        skl::lock_guard_t guard{g_buffer_pool_caches_lock};
+        next = g_buffer_pool_caches;
+        if (nullptr != next) {
+            next->prev = this;
+        }
+        g_buffer_pool_caches = this;
+    }
+
+    void tls_destroy() noexcept {
+        skl::lock_guard_t guard{g_buffer_pool_caches_lock};
+        flush();
 
-    static constexpr u32 CAllocCount = CBufferSize >= CMinBlockSize ? 1u : (CMinBlockSize / CBufferSize);
-    static constexpr u32 CAllignment = CBufferSize >= SKL_CACHE_LINE_SIZE ? SKL_CACHE_LINE_SIZE : sizeof(void*);
+        if (nullptr != prev) {
+            prev->next = next;
+        } else {
+            g_buffer_pool_caches = next;
+        }
+        if (nullptr != next) {
+            next->prev = prev;
+        }
+        prev = nullptr;
+        next = nullptr;
+    }
+};
+} // namespace
+SKL_MAKE_TLS_SINGLETON(BufferPoolThreadCache, g_buffer_pool_tls);
 
-    for (u32 i = 0u; i < CAllocCount; ++i) {
-        void* buffer = skl::skl_vector_alloc(CBufferSize, CAllignment);
+namespace {
+//! Get the calling thread cache, drops the cached buffers of a destroyed pool
+[[nodiscard]] SKL_FORCEINLINE BufferPoolThreadCache& buffer_pool_thread_cache() noexcept {
+    auto& cache = g_buffer_pool_tls::tls_guarded();
+    if (cache.generation != g_buffer_pool_generation.load_relaxed()) [[unlikely]] {
+        cache.reset();
+    }
+    return cache;
+}
+
+//! Slow path: Allocate new buffers, hand the first batch to the caller and push the rest to the central list
+[[gnu::noinline]] free_node_t* populate_bucket_with_buffers(u32 f_bucket_index) noexcept {
+    SKL_ASSERT(f_bucket_index >= CMinBucketIndex && f_bucket_index <= CMaxBucketIndex);
+
+    const u32 buffer_size = 1u << f_bucket_index;
+    const u32 alloc_count = buffer_size >= CMinBlockSize ? 1u : (CMinBlockSize / buffer_size);
+    const u32 alignment   = buffer_size >= SKL_CACHE_LINE_SIZE ? SKL_CACHE_LINE_SIZE : sizeof(void*);
+    const u32 batch_size  = bucket_batch_size(f_bucket_index);
+
+    free_node_t* first_batch = nullptr;
+    free_node_t* last_batch  = nullptr;
+    free_node_t* batch       = nullptr;
+    for (u32 i = 0u; i < alloc_count; ++i) {
+        void* buffer = skl::skl_vector_alloc(buffer_size, alignment);
         SKL_ASSERT_PERMANENT(nullptr != buffer);
+#if defined(SKL_CORE_TESTING)
+        (void)g_buffer_pool_system_buffers.increment();
+#endif
+
+        auto* node = reinterpret_cast<free_node_t*>(buffer);
+        if ((nullptr == batch) || (batch_size == batch->batch_count)) {
+            // Start a new batch
+            node->next        = nullptr;
+            node->next_batch  = nullptr;
+            node->batch_count = 1u;
+            if (nullptr == first_batch) {
+                first_batch = node;
+            } else {
+                last_batch->next_batch = node;
+            }
+            last_batch = node;
+            batch      = node;
+        } else {
+            // Add to the current batch (after the head)
+            node->next  = batch->next;
+            batch->next = node;
+            ++batch->batch_count;
+        }
+    }
+
+    if (first_batch != last_batch) {
+        g_buffer_bucket_central[f_bucket_index].push(first_batch->next_batch, last_batch);
+    }
 
-        // Add single buffer to freelist
-        auto* node                         = reinterpret_cast<free_node_t*>(buffer);
-        node->next                         = g_buffer_bucket_heads[BucketIndex];
-        g_buffer_bucket_heads[BucketIndex] = node;
+    return first_batch;
+}
+
+//! Slow path: Refill the empty magazine from the spare batch, the central list or new buffers
+[[gnu::noinline]] void refill_magazine(magazine_t& f_magazine, u32 f_bucket_index) noexcept {
+    free_node_t* batch = f_magazine.spare;
+    if (nullptr != batch) {
+        f_magazine.spare = nullptr;
+    } else {
+        batch = g_buffer_bucket_central[f_bucket_index].pop();
+        if (nullptr == batch) {
+            batch = populate_bucket_with_buffers(f_bucket_index);
+        }
+    }
+
+    f_magazine.current       = batch;
+    f_magazine.current_count = batch->batch_count;
+}
+
+//! Slow path: The magazine is full, keep it as the spare batch and spill the previous spare batch to the central list
+[[gnu::noinline]] void spill_magazine(magazine_t& f_magazine, u32 f_bucket_index) noexcept {
+    if (nullptr != f_magazine.spare) {
+        g_buffer_bucket_central[f_bucket_index].push(f_magazine.spare, f_magazine.spare);
     }
+
+    f_magazine.current->batch_count = f_magazine.current_count;
+    f_magazine.spare                = f_magazine.current;
+    f_magazine.current              = nullptr;
+    f_magazine.current_count        = 0u;
 }
 
-//! Fast path: Allocate from bucket's intrusive freelist
-template <u32 BucketIndex>
-void* allocate_from_bucket() noexcept {
-    free_node_t* head = g_buffer_bucket_heads[BucketIndex];
+//! Fast path: Allocate from the thread cache
+[[nodiscard]] SKL_FORCEINLINE void* allocate_from_bucket(u32 f_bucket_index) noexcept {
+    auto& magazine = buffer_pool_thread_cache().magazines[f_bucket_index];
 
-    // Slow path: bucket empty, need to allocate new buffer page
-    if (head == nullptr) [[unlikely]] {
-        populate_bucket_with_buffers<BucketIndex>();
-        head = g_buffer_bucket_heads[BucketIndex];
+    // Slow path: magazine empty, refill it
+    if (nullptr == magazine.current) [[unlikely]] {
+        refill_magazine(magazine, f_bucket_index);
     }
 
-    // Pop head from freelist
-    g_buffer_bucket_heads[BucketIndex] = head->next;
+    // Pop head from the magazine
+    free_node_t* head = magazine.current;
+    magazine.current  = head->next;
+    --magazine.current_count;
     return head;
 }
 
-//! Fast path: Free buffer back to bucket's intrusive freelist
-template <u32 BucketIndex>
-void free_to_bucket(void* f_buffer) noexcept {
-    // Push to head of freelist
-    auto* node                         = reinterpret_cast<free_node_t*>(f_buffer);
-    node->next                         = g_buffer_bucket_heads[BucketIndex];
-    g_buffer_bucket_heads[BucketIndex] = node;
+//! Fast path: Free buffer to the thread cache
+SKL_FORCEINLINE void free_to_bucket(void* f_buffer, u32 f_bucket_index) noexcept {
+    auto& magazine = buffer_pool_thread_cache().magazines[f_bucket_index];
+
+    // Slow path: magazine full, spill it
+    if (bucket_batch_size(f_bucket_index) == magazine.current_count) [[unlikely]] {
+        spill_magazine(magazine, f_bucket_index);
+    }
+
+    // Push to head of the magazine
+    auto* node       = reinterpret_cast<free_node_t*>(f_buffer);
+    node->next       = magazine.current;
+    magazine.current = node;
+    ++magazine.current_count;
 }
 
 #if !SKL_BUILD_SHIPPING
@@ -100,6 +329,8 @@ void free_to_bucket(void* f_buffer) noexcept {
 [[gnu::noinline]] void validate_buffer_for_free(void* f_buffer, u32 f_bucket_index) noexcept {
     SKL_ASSERT_PERMANENT(nullptr != f_buffer);
 
+    skl::lock_guard_t guard{g_allocated_buffers_lock};
+
     // Validate buffer was actually allocated from this specific bucket
     auto&      bucket_set   = g_allocated_buffers[f_bucket_index];
     const bool is_allocated = bucket_set.contains(f_buffer);
@@ -146,19 +377,48 @@ skl_status BufferPool::construct_pool(bool f_warmup) noexcept {
 }
 
 void BufferPool::destroy_pool() noexcept {
+    // Return the buffers cached by all the live threads (none of them is using the pool, see the precondition)
+    {
+        lock_guard_t guard{g_buffer_pool_caches_lock};
+        for (auto* cache = g_buffer_pool_caches; nullptr != cache; cache = cache->next) {
+            cache->flush();
+        }
+        (void)g_buffer_pool_generation.increment();
+    }
+
     for (u32 i = CMinBucketIndex; i <= CMaxBucketIndex; ++i) {
-        free_node_t* head = g_buffer_bucket_heads[i];
+        free_node_t* batch = g_buffer_bucket_central[i].take_all();
 
-        // Free all buffers in the bucket's freelist
-        while (head != nullptr) {
-            free_node_t* next = head->next;
+        // Free all buffers of all batches in the bucket's central list
+        while (batch != nullptr) {
+            free_node_t* next_batch = batch->next_batch;
 
-            skl::skl_vector_free(head);
+            free_node_t* head = batch;
+            while (head != nullptr) {
+                free_node_t* next = head->next;
 
-            head = next;
+                skl_vector_free(head);
+#if defined(SKL_CORE_TESTING)
+                (void)g_buffer_pool_system_buffers.decrement();
+#endif
+
+                head = next;
+            }
+
+            batch = next_batch;
         }
+    }
+}
 
-        g_buffer_bucket_heads[i] = nullptr;
+#if defined(SKL_CORE_TESTING)
+u64 BufferPool::system_buffers_count() noexcept {
+    return g_buffer_pool_system_buffers.load_relaxed();
+}
+#endif
+
+void BufferPool::flush_thread_cache() noexcept {
+    if (g_buffer_pool_tls::tls_init_status()) {
+        g_buffer_pool_tls::tls_checked().flush();
     }
 }
 
@@ -174,94 +434,7 @@ BufferPool::buffer_t BufferPool::buffer_alloc(u32 f_size) noexcept {
     const u32 bucket_index = buffer_get_pool_index(total_size).value();
     const u32 actual_size  = buffer_get_size_for_bucket(bucket_index);
 
-    void* ptr = nullptr;
-
-    // Dispatch to bucket
-    switch (bucket_index) {
-        case 5:
-            ptr = allocate_from_bucket<5>();
-            break;
-        case 6:
-            ptr = allocate_from_bucket<6>();
-            break;
-        case 7:
-            ptr = allocate_from_bucket<7>();
-            break;
-        case 8:
-            ptr = allocate_from_bucket<8>();
-            break;
-        case 9:
-            ptr = allocate_from_bucket<9>();
-            break;
-        case 10:
-            ptr = allocate_from_bucket<10>();
-            break;
-        case 11:
-            ptr = allocate_from_bucket<11>();
-            break;
-        case 12:
-            ptr = allocate_from_bucket<12>();
-            break;
-        case 13:
-            ptr = allocate_from_bucket<13>();
-            break;
-        case 14:
-            ptr = allocate_from_bucket<14>();
-            break;
-        case 15:
-            ptr = allocate_from_bucket<15>();
-            break;
-        case 16:
-            ptr = allocate_from_bucket<16>();
-            break;
-        case 17:
-            ptr = allocate_from_bucket<17>();
-            break;
-        case 18:
-            ptr = allocate_from_bucket<18>();
-            break;
-        case 19:
-            ptr = allocate_from_bucket<19>();
-            break;
-        case 20:
-            ptr = allocate_from_bucket<20>();
-            break;
-        case 21:
-            ptr = allocate_from_bucket<21>();
-            break;
-        case 22:
-            ptr = allocate_from_bucket<22>();
-            break;
-        case 23:
-            ptr = allocate_from_bucket<23>();
-            break;
-        case 24:
-            ptr = allocate_from_bucket<24>();
-            break;
-        case 25:
-            ptr = allocate_from_bucket<25>();
-            break;
-        case 26:
-            ptr = allocate_from_bucket<26>();
-            break;
-        case 27:
-            ptr = allocate_from_bucket<27>();
-            break;
-        case 28:
-            ptr = allocate_from_bucket<28>();
-            break;
-        case 29:
-            ptr = allocate_from_bucket<29>();
-            break;
-        case 30:
-            ptr = allocate_from_bucket<30>();
-            break;
-        case 31:
-            ptr = allocate_from_bucket<31>();
-            break;
-        default:
-            SKL_ASSERT_PERMANENT(false && "Invalid bucket index");
-    }
+    void* ptr = allocate_from_bucket(bucket_index);
 
     if (nullptr == ptr) [[unlikely]] {
         return {};
@@ -279,7 +452,10 @@ BufferPool::buffer_t BufferPool::buffer_alloc(u32 f_size) noexcept {
     const u32 usable_size = actual_size - CHeaderSize;
 
 #if !SKL_BUILD_SHIPPING
-    g_allocated_buffers[bucket_index].insert(user_ptr);
+    {
+        lock_guard_t guard{g_allocated_buffers_lock};
+        g_allocated_buffers[bucket_index].insert(user_ptr);
+    }
 #endif
 
     return buffer_t{usable_size, user_ptr};
@@ -308,91 +484,13 @@ void BufferPool::buffer_free(void* f_ptr) noexcept {
     // Free the raw pointer (header start, not user pointer)
     void* raw_ptr = header;
 
-    // Dispatch to bucket
-    switch (bucket_index) {
-        case 5:
-            free_to_bucket<5>(raw_ptr);
-            break;
-        case 6:
-            free_to_bucket<6>(raw_ptr);
-            break;
-        case 7:
-            free_to_bucket<7>(raw_ptr);
-            break;
-        case 8:
-            free_to_bucket<8>(raw_ptr);
-            break;
-        case 9:
-            free_to_bucket<9>(raw_ptr);
-            break;
-        case 10:
-            free_to_bucket<10>(raw_ptr);
-            break;
-        case 11:
-            free_to_bucket<11>(raw_ptr);
-            break;
-        case 12:
-            free_to_bucket<12>(raw_ptr);
-            break;
-        case 13:
-            free_to_bucket<13>(raw_ptr);
-            break;
-        case 14:
-            free_to_bucket<14>(raw_ptr);
-            break;
-        case 15:
-            free_to_bucket<15>(raw_ptr);
-            break;
-        case 16:
-            free_to_bucket<16>(raw_ptr);
-            break;
-        case 17:
-            free_to_bucket<17>(raw_ptr);
-            break;
-        case 18:
-            free_to_bucket<18>(raw_ptr);
-            break;
-        case 19:
-            free_to_bucket<19>(raw_ptr);
-            break;
-        case 20:
-            free_to_bucket<20>(raw_ptr);
-            break;
-        case 21:
-            free_to_bucket<21>(raw_ptr);
-            break;
-        case 22:
-            free_to_bucket<22>(raw_ptr);
-            break;
-        case 23:
-            free_to_bucket<23>(raw_ptr);
-            break;
-        case 24:
-            free_to_bucket<24>(raw_ptr);
-            break;
-        case 25:
-            free_to_bucket<25>(raw_ptr);
-            break;
-        case 26:
-            free_to_bucket<26>(raw_ptr);
-            break;
-        case 27:
-            free_to_bucket<27>(raw_ptr);
-            break;
-        case 28:
-            free_to_bucket<28>(raw_ptr);
-            break;
-        case 29:
-            free_to_bucket<29>(raw_ptr);
-            break;
-        case 30:
-            free_to_bucket<30>(raw_ptr);
-            break;
-        case 31:
-            free_to_bucket<31>(raw_ptr);
-            break;
-        default:
-            SKL_ASSERT_PERMANENT(false && "Invalid bucket index");
-    }
+    free_to_bucket(raw_ptr, bucket_index);
+}
+} // namespace skl
+
+namespace skl {
+void skl_core_deinit_thread__buffer_pool() noexcept {
+    // Returns the cached buffers to the shared lists
+    g_buffer_pool_tls::tls_destroy();
 }
 } // namespace skl
@@ -1,6 +1,10 @@
+#include <sched.h>
+
 #include "skl_pool/hugepage_buffer_pool"
 #include "skl_huge_pages"
 #include "skl_fixed_vector_if"
+#include "skl_core_info"
+#include "skl_spin_lock"
 
 #if !SKL_BUILD_SHIPPING
 #    include <unordered_set>
@@ -17,16 +21,17 @@ struct free_node_t {
 //! User pointer is rebased past this header
 struct buffer_header_t {
     u32 allocated_size; //!< Actual allocated size (power of 2, includes header)
+    u16 numa_node;      //!< Numa node the buffer belongs to
 #if !SKL_BUILD_SHIPPING
-    u32 magic; //!< Debug magic number for validation
+    u16 magic; //!< Debug magic number for validation
 #else
-    u32 _padding; //!< Keep 8-byte alignment in shipping
+    u16 _padding; //!< Keep 8-byte alignment in shipping
 #endif
 };
 static_assert(sizeof(buffer_header_t) == 8, "Header must be 8 bytes for alignment");
 
 //! Magic number for debug validation
-[[maybe_unused]] constexpr u32 CBufferMagic = 0xB0FFE42D;
+[[maybe_unused]] constexpr u16 CBufferMagic = 0xE42D;
 
 //! Tracking entry for allocated huge pages
 struct hugepage_ptr_t {
@@ -42,8 +47,17 @@ struct metadata_t {
     //! Tracking of all allocated huge pages (buffer pages only, no freelist overhead)
     //! 65,536 entries = 128GB max capacity
     skl::skl_fixed_vector<hugepage_ptr_t, 1 << 16u> allpages;
+
+    //! Usage counters of the node
+    skl::HugePageBufferPool::numa_node_stats_t stats{};
 };
 static_assert(sizeof(metadata_t) <= skl::huge_pages::CHugePageSize, "Metadata size exceeds huge page size");
+
+//! Per numa node pool partition
+struct SKL_CACHE_ALIGNED numa_pool_t {
+    skl::spin_lock_t lock;               //!< Guards the metadata (frees can come from any thread)
+    metadata_t*      metadata = nullptr; //!< Node metadata, placed on the node
+};
 } // namespace
 
 namespace {
@@ -55,19 +69,32 @@ constexpr u32                 CHeaderSize     = sizeof(buffer_header_t); //!< Si
 
 static_assert(sizeof(free_node_t) <= (1u << CMinBucketIndex), "Free node must fit in minimum buffer size");
 
-//! Global metadata pointer
-metadata_t* g_metadata = nullptr;
+//! Marker for a thread whose numa node was not resolved yet
+constexpr u32 CNumaNodeUnresolved = u32(-1);
+
+//! Per numa node partitions
+numa_pool_t g_numa_pools[skl::CNumaMaxNodes];
+
+//! Count of constructed partitions (0 if the pool is not constructed)
+u32 g_numa_nodes_count = 0u;
+
+//! Topology the pool was constructed with
+skl::numa_topology_t g_numa_topology{};
+
+//! Numa node of the current thread
+thread_local u32 g_thread_numa_node = CNumaNodeUnresolved;
 
 #if !SKL_BUILD_SHIPPING
 //! [Debug] Track all currently allocated buffers for validation
 std::unordered_set<void*> g_allocated_buffers[CMaxBuckets];
+skl::spin_lock_t          g_allocated_buffers_lock;
 #endif
 } // namespace
 
 namespace {
 //! Slow path: Allocate a new buffer page and link all buffers into the freelist
 template <u32 BucketIndex>
-[[gnu::noinline]] void populate_bucket_with_buffers() noexcept {
+[[gnu::noinline]] void populate_bucket_with_buffers(metadata_t& f_metadata, u32 f_numa_node) noexcept {
     static_assert(BucketIndex >= CMinBucketIndex && BucketIndex <= CMaxBucketIndex, "Invalid bucket index");
 
     constexpr u32 CBufferSize      = 1u << BucketIndex;
@@ -77,15 +104,16 @@ template <u32 BucketIndex>
 
     if constexpr (CBufferSize <= skl::huge_pages::CHugePageSize) {
         // Allocate 1 huge page for buffers
-        void* buffer_page = skl::huge_pages::skl_huge_page_alloc(1);
+        void* buffer_page = skl::huge_pages::skl_huge_page_alloc_on_node(1, f_numa_node);
         SKL_ASSERT_PERMANENT(nullptr != buffer_page);
 
         // Track allocation
-        SKL_ASSERT_PERMANENT(!g_metadata->allpages.full() && "Huge page tracking limit reached (128GB)");
-        g_metadata->allpages.upgrade().push_back({buffer_page, 1});
+        SKL_ASSERT_PERMANENT(!f_metadata.allpages.full() && "Huge page tracking limit reached (128GB)");
+        f_metadata.allpages.upgrade().push_back({buffer_page, 1});
+        f_metadata.stats.m_pages_count += 1u;
 
         // Link all buffers into the intrusive freelist (prepend to existing chain)
-        free_node_t* head       = g_metadata->bucket_heads[BucketIndex];
+        free_node_t* head       = f_metadata.bucket_heads[BucketIndex];
         byte*        buffer_ptr = reinterpret_cast<byte*>(buffer_page);
 
         for (u32 i = 0; i < CBuffersToCreate; ++i) {
@@ -95,48 +123,67 @@ template <u32 BucketIndex>
             buffer_ptr += CBufferSize;
         }
 
-        g_metadata->bucket_heads[BucketIndex] = head;
+        f_metadata.bucket_heads[BucketIndex] = head;
     } else {
         // Large buffer: allocate multiple contiguous huge pages (1 buffer per allocation)
         constexpr u64 CPageCount = skl::integral_ceil<u64>(CBufferSize, skl::huge_pages::CHugePageSize);
 
-        void* buffer = skl::huge_pages::skl_huge_page_alloc(CPageCount);
+        void* buffer = skl::huge_pages::skl_huge_page_alloc_on_node(CPageCount, f_numa_node);
         SKL_ASSERT_PERMANENT(nullptr != buffer);
 
         // Track allocation with actual page count
-        SKL_ASSERT_PERMANENT(!g_metadata->allpages.full() && "Huge page tracking limit reached (128GB)");
-        g_metadata->allpages.upgrade().push_back({buffer, CPageCount});
+        SKL_ASSERT_PERMANENT(!f_metadata.allpages.full() && "Huge page tracking limit reached (128GB)");
+        f_metadata.allpages.upgrade().push_back({buffer, CPageCount});
+        f_metadata.stats.m_pages_count += CPageCount;
 
         // Add single buffer to freelist
-        auto* node                            = reinterpret_cast<free_node_t*>(buffer);
-        node->next                            = g_metadata->bucket_heads[BucketIndex];
-        g_metadata->bucket_heads[BucketIndex] = node;
+        auto* node                           = reinterpret_cast<free_node_t*>(buffer);
+        node->next                           = f_metadata.bucket_heads[BucketIndex];
+        f_metadata.bucket_heads[BucketIndex] = node;
     }
 }
 
 //! Fast path: Allocate from bucket's intrusive freelist
 template <u32 BucketIndex>
-void* allocate_from_bucket() noexcept {
-    free_node_t* head = g_metadata->bucket_heads[BucketIndex];
+void* allocate_from_bucket(metadata_t& f_metadata, u32 f_numa_node) noexcept {
+    free_node_t* head = f_metadata.bucket_heads[BucketIndex];
 
     // Slow path: bucket empty, need to allocate new buffer page
     if (head == nullptr) [[unlikely]] {
-        populate_bucket_with_buffers<BucketIndex>();
-        head = g_metadata->bucket_heads[BucketIndex];
+        populate_bucket_with_buffers<BucketIndex>(f_metadata, f_numa_node);
+        head = f_metadata.bucket_heads[BucketIndex];
     }
 
     // Pop head from freelist
-    g_metadata->bucket_heads[BucketIndex] = head->next;
+    f_metadata.bucket_heads[BucketIndex] = head->next;
     return head;
 }
 
 //! Fast path: Free buffer back to bucket's intrusive freelist
 template <u32 BucketIndex>
-void free_to_bucket(void* f_buffer) noexcept {
+void free_to_bucket(metadata_t& f_metadata, void* f_buffer) noexcept {
     // Push to head of freelist
-    auto* node                            = reinterpret_cast<free_node_t*>(f_buffer);
-    node->next                            = g_metadata->bucket_heads[BucketIndex];
-    g_metadata->bucket_heads[BucketIndex] = node;
+    auto* node                           = reinterpret_cast<free_node_t*>(f_buffer);
+    node->next                           = f_metadata.bucket_heads[BucketIndex];
+    f_metadata.bucket_heads[BucketIndex] = node;
+}
+
+//! Resolve the numa node of the calling thread from the cpu it currently runs on
+[[gnu::noinline]] u32 resolve_thread_numa_node() noexcept {
+    const i32 cpu  = ::sched_getcpu();
+    const u32 node = (cpu < 0) ? 0u : g_numa_topology.node_of_cpu(u32(cpu));
+
+    g_thread_numa_node = (node < g_numa_nodes_count) ? node : 0u;
+    return g_thread_numa_node;
+}
+
+//! Get the numa node of the calling thread (resolved once per thread)
+u32 current_thread_numa_node() noexcept {
+    const u32 node = g_thread_numa_node;
+    if (node < g_numa_nodes_count) [[likely]] {
+        return node;
+    }
+    return resolve_thread_numa_node();
 }
 
 #if !SKL_BUILD_SHIPPING
@@ -144,6 +191,8 @@ void free_to_bucket(void* f_buffer) noexcept {
 [[gnu::noinline]] void validate_buffer_for_free(void* f_buffer, u32 f_bucket_index) noexcept {
     SKL_ASSERT_PERMANENT(nullptr != f_buffer);
 
+    skl::lock_guard_t guard{g_allocated_buffers_lock};
+
     // Validate buffer was actually allocated from this specific bucket
     auto&      bucket_set   = g_allocated_buffers[f_bucket_index];
     const bool is_allocated = bucket_set.contains(f_buffer);
@@ -173,46 +222,103 @@ namespace skl {
 }
 
 skl_status HugePageBufferPool::construct_pool() noexcept {
+    return construct_pool(skl_core_get_numa_topology());
+}
+
+skl_status HugePageBufferPool::construct_pool(const numa_topology_t& f_topology) noexcept {
     // Check if already initialized
-    if (nullptr != g_metadata) {
+    if (0u != g_numa_nodes_count) {
         return SKL_ERR_STATE;
     }
 
-    // Allocate metadata structure (1 huge page)
-    g_metadata = reinterpret_cast<metadata_t*>(huge_pages::skl_huge_page_alloc(1));
-    if (nullptr == g_metadata) {
-        return SKL_ERR_ALLOC;
+    if ((0u == f_topology.m_nodes_count) || (CNumaMaxNodes < f_topology.m_nodes_count)) {
+        return SKL_ERR_PARAMS;
+    }
+
+    // Allocate metadata structure for each node (1 huge page, placed on the node)
+    for (u32 node = 0u; node < f_topology.m_nodes_count; ++node) {
+        auto* metadata = reinterpret_cast<metadata_t*>(huge_pages::skl_huge_page_alloc_on_node(1, node));
+        if (nullptr == metadata) {
+            for (u32 i = 0u; i < node; ++i) {
+                g_numa_pools[i].metadata->~metadata_t();
+                huge_pages::skl_huge_page_free(g_numa_pools[i].metadata, 1);
+                g_numa_pools[i].metadata = nullptr;
+            }
+            return SKL_ERR_ALLOC;
+        }
+
+        // Initialize metadata
+        g_numa_pools[node].metadata = new (metadata) metadata_t();
     }
 
-    // Initialize metadata
-    new (g_metadata) metadata_t();
+    g_numa_topology    = f_topology;
+    g_numa_nodes_count = f_topology.m_nodes_count;
 
     return SKL_SUCCESS;
 }
 
 void HugePageBufferPool::destroy_pool() noexcept {
-    if (nullptr == g_metadata) {
+    if (0u == g_numa_nodes_count) {
         return;
     }
 
-    // Free all tracked buffer pages
-    for (const auto& page : g_metadata->allpages) {
-        if (page.ptr != nullptr) {
-            huge_pages::skl_huge_page_free(page.ptr, page.page_count);
+    for (u32 node = 0u; node < g_numa_nodes_count; ++node) {
+        auto*& metadata = g_numa_pools[node].metadata;
+
+        // Free all tracked buffer pages
+        for (const auto& page : metadata->allpages) {
+            if (page.ptr != nullptr) {
+                huge_pages::skl_huge_page_free(page.ptr, page.page_count);
+            }
         }
+
+        // Destroy and free metadata
+        metadata->~metadata_t();
+        huge_pages::skl_huge_page_free(metadata, 1);
+        metadata = nullptr;
+    }
+
+    g_numa_nodes_count = 0u;
+}
+
+u32 HugePageBufferPool::numa_nodes_count() noexcept {
+    return g_numa_nodes_count;
+}
+
+u32 HugePageBufferPool::thread_numa_node() noexcept {
+    SKL_ASSERT_PERMANENT(0u != g_numa_nodes_count);
+    return current_thread_numa_node();
+}
+
+void HugePageBufferPool::set_thread_numa_node(u32 f_numa_node) noexcept {
+    SKL_ASSERT_PERMANENT(f_numa_node < g_numa_nodes_count);
+    g_thread_numa_node = f_numa_node;
+}
+
+void HugePageBufferPool::reset_thread_numa_node() noexcept {
+    g_thread_numa_node = CNumaNodeUnresolved;
+}
+
+u32 HugePageBufferPool::buffer_get_numa_node(const void* f_ptr) noexcept {
+    SKL_ASSERT_PERMANENT(nullptr != f_ptr);
+    return reinterpret_cast<const buffer_header_t*>(static_cast<const byte*>(f_ptr) - CHeaderSize)->numa_node;
+}
+
+skl_result<HugePageBufferPool::numa_node_stats_t> HugePageBufferPool::get_numa_node_stats(u32 f_numa_node) noexcept {
+    if (f_numa_node >= g_numa_nodes_count) {
+        return skl_fail{SKL_ERR_PARAMS};
     }
 
-    // Destroy and free metadata
-    g_metadata->~metadata_t();
-    huge_pages::skl_huge_page_free(g_metadata, 1);
-    g_metadata = nullptr;
+    auto&             pool = g_numa_pools[f_numa_node];
+    skl::lock_guard_t guard{pool.lock};
+    return pool.metadata->stats;
 }
 
 HugePageBufferPool::buffer_t HugePageBufferPool::buffer_alloc(u32 f_size) noexcept {
     // Max requestable size accounts for header overhead
     constexpr u32 CMaxRequestSize = CMaxBufferSize - CHeaderSize;
 
-    SKL_ASSERT_PERMANENT((nullptr != g_metadata) && (f_size <= CMaxRequestSize));
+    SKL_ASSERT_PERMANENT((0u != g_numa_nodes_count) && (f_size <= CMaxRequestSize));
 
     // Safe to add now - overflow is impossible after the above check
     const u32 total_size = f_size + CHeaderSize;
@@ -220,83 +326,98 @@ HugePageBufferPool::buffer_t HugePageBufferPool::buffer_alloc(u32 f_size) noexce
     const u32 bucket_index = buffer_get_pool_index(total_size).value();
     const u32 actual_size  = buffer_get_size_for_bucket(bucket_index);
 
+    const u32 numa_node = current_thread_numa_node();
+    auto&     pool      = g_numa_pools[numa_node];
+    auto&     metadata  = *pool.metadata;
+
     void* ptr = nullptr;
 
+    pool.lock.lock();
+
     // Dispatch to bucket
     switch (bucket_index) {
         case 5:
-            ptr = allocate_from_bucket<5>();
+            ptr = allocate_from_bucket<5>(metadata, numa_node);
             break;
         case 6:
-            ptr = allocate_from_bucket<6>();
+            ptr = allocate_from_bucket<6>(metadata, numa_node);
             break;
         case 7:
-            ptr = allocate_from_bucket<7>();
+            ptr = allocate_from_bucket<7>(metadata, numa_node);
             break;
         case 8:
-            ptr = allocate_from_bucket<8>();
+            ptr = allocate_from_bucket<8>(metadata, numa_node);
             break;
         case 9:
-            ptr = allocate_from_bucket<9>();
+            ptr = allocate_from_bucket<9>(metadata, numa_node);
             break;
         case 10:
-            ptr = allocate_from_bucket<10>();
+            ptr = allocate_from_bucket<10>(metadata, numa_node);
             break;
         case 11:
-            ptr = allocate_from_bucket<11>();
+            ptr = allocate_from_bucket<11>(metadata, numa_node);
             break;
         case 12:
-            ptr = allocate_from_bucket<12>();
+            ptr = allocate_from_bucket<12>(metadata, numa_node);
             break;
         case 13:
-            ptr = allocate_from_bucket<13>();
+            ptr = allocate_from_bucket<13>(metadata, numa_node);
             break;
         case 14:
-            ptr = allocate_from_bucket<14>();
+            ptr = allocate_from_bucket<14>(metadata, numa_node);
             break;
         case 15:
-            ptr = allocate_from_bucket<15>();
+            ptr = allocate_from_bucket<15>(metadata, numa_node);
             break;
         case 16:
-            ptr = allocate_from_bucket<16>();
+            ptr = allocate_from_bucket<16>(metadata, numa_node);
             break;
         case 17:
-            ptr = allocate_from_bucket<17>();
+            ptr = allocate_from_bucket<17>(metadata, numa_node);
             break;
         case 18:
-            ptr = allocate_from_bucket<18>();
+            ptr = allocate_from_bucket<18>(metadata, numa_node);
             break;
         case 19:
-            ptr = allocate_from_bucket<19>();
+            ptr = allocate_from_bucket<19>(metadata, numa_node);
             break;
         case 20:
-            ptr = allocate_from_bucket<20>();
+            ptr = allocate_from_bucket<20>(metadata, numa_node);
             break;
         case 21:
-            ptr = allocate_from_bucket<21>();
+            ptr = allocate_from_bucket<21>(metadata, numa_node);
             break;
         case 22:
-            ptr = allocate_from_bucket<22>();
+            ptr = allocate_from_bucket<22>(metadata, numa_node);
             break;
         case 23:
-            ptr = allocate_from_bucket<23>();
+            ptr = allocate_from_bucket<23>(metadata, numa_node);
             break;
         case 24:
-            ptr = allocate_from_bucket<24>();
+            ptr = allocate_from_bucket<24>(metadata, numa_node);
             break;
         case 25:
-            ptr = allocate_from_bucket<25>();
+            ptr = allocate_from_bucket<25>(metadata, numa_node);
             break;
         case 26:
-            ptr = allocate_from_bucket<26>();
+            ptr = allocate_from_bucket<26>(metadata, numa_node);
             break;
         case 27:
-            ptr = allocate_from_bucket<27>();
+            ptr = allocate_from_bucket<27>(metadata, numa_node);
             break;
         default:
             SKL_ASSERT_PERMANENT(false && "Invalid bucket index");
     }
 
+    // Count only the buffers actually handed out (buffer_free() undoes these)
+    if (nullptr != ptr) [[likely]] {
+        metadata.stats.m_alloc_count += 1u;
+        metadata.stats.m_allocated_count += 1u;
+        metadata.stats.m_allocated_bytes += actual_size;
+    }
+
+    pool.lock.unlock();
+
     if (nullptr == ptr) [[unlikely]] {
         return {};
     }
@@ -304,6 +425,7 @@ HugePageBufferPool::buffer_t HugePageBufferPool::buffer_alloc(u32 f_size) noexce
     // Write header at start of buffer
     auto* header           = reinterpret_cast<buffer_header_t*>(ptr);
     header->allocated_size = actual_size;
+    header->numa_node      = u16(numa_node);
 #if !SKL_BUILD_SHIPPING
     header->magic = CBufferMagic;
 #endif
@@ -313,7 +435,10 @@ HugePageBufferPool::buffer_t HugePageBufferPool::buffer_alloc(u32 f_size) noexce
     const u32 usable_size = actual_size - CHeaderSize;
 
 #if !SKL_BUILD_SHIPPING
-    g_allocated_buffers[bucket_index].insert(user_ptr);
+    {
+        skl::lock_guard_t guard{g_allocated_buffers_lock};
+        g_allocated_buffers[bucket_index].insert(user_ptr);
+    }
 #endif
 
     return buffer_t{usable_size, user_ptr};
@@ -324,7 +449,7 @@ void HugePageBufferPool::buffer_free(buffer_t f_alloc) noexcept {
 }
 
 void HugePageBufferPool::buffer_free_ptr(void* f_ptr) noexcept {
-    SKL_ASSERT_PERMANENT((nullptr != g_metadata)
+    SKL_ASSERT_PERMANENT((0u != g_numa_nodes_count)
                          && "HugePageBufferPool already destroyed: free all hugepage allocations before skl_core_deinit()");
     SKL_ASSERT_PERMANENT(nullptr != f_ptr);
 
@@ -348,76 +473,90 @@ void HugePageBufferPool::buffer_free_ptr(void* f_ptr) noexcept {
     // Free the raw pointer (header start, not user pointer)
     void* raw_ptr = header;
 
+    // Buffers always go back to the node that owns them
+    const u32 numa_node = header->numa_node;
+    SKL_ASSERT_PERMANENT(numa_node < g_numa_nodes_count);
+
+    const bool is_remote = numa_node != current_thread_numa_node();
+    auto&      pool      = g_numa_pools[numa_node];
+    auto&      metadata  = *pool.metadata;
+
+    skl::lock_guard_t guard{pool.lock};
+
+    metadata.stats.m_allocated_count -= 1u;
+    metadata.stats.m_allocated_bytes -= actual_size;
+    metadata.stats.m_remote_free_count += is_remote ? 1u : 0u;
+
     // Dispatch to bucket
     switch (bucket_index) {
         case 5:
-            free_to_bucket<5>(raw_ptr);
+            free_to_bucket<5>(metadata, raw_ptr);
             break;
         case 6:
-            free_to_bucket<6>(raw_ptr);
+            free_to_bucket<6>(metadata, raw_ptr);
             break;
         case 7:
-            free_to_bucket<7>(raw_ptr);
+            free_to_bucket<7>(metadata, raw_ptr);
             break;
         case 8:
-            free_to_bucket<8>(raw_ptr);
+            free_to_bucket<8>(metadata, raw_ptr);
             break;
         case 9:
-            free_to_bucket<9>(raw_ptr);
+            free_to_bucket<9>(metadata, raw_ptr);
             break;
         case 10:
-            free_to_bucket<10>(raw_ptr);
+            free_to_bucket<10>(metadata, raw_ptr);
             break;
         case 11:
-            free_to_bucket<11>(raw_ptr);
+            free_to_bucket<11>(metadata, raw_ptr);
             break;
         case 12:
-            free_to_bucket<12>(raw_ptr);
+            free_to_bucket<12>(metadata, raw_ptr);
             break;
         case 13:
-            free_to_bucket<13>(raw_ptr);
+            free_to_bucket<13>(metadata, raw_ptr);
             break;
         case 14:
-            free_to_bucket<14>(raw_ptr);
+            free_to_bucket<14>(metadata, raw_ptr);
             break;
         case 15:
-            free_to_bucket<15>(raw_ptr);
+            free_to_bucket<15>(metadata, raw_ptr);
             break;
         case 16:
-            free_to_bucket<16>(raw_ptr);
+            free_to_bucket<16>(metadata, raw_ptr);
             break;
         case 17:
-            free_to_bucket<17>(raw_ptr);
+            free_to_bucket<17>(metadata, raw_ptr);
             break;
         case 18:
-            free_to_bucket<18>(raw_ptr);
+            free_to_bucket<18>(metadata, raw_ptr);
             break;
         case 19:
-            free_to_bucket<19>(raw_ptr);
+            free_to_bucket<19>(metadata, raw_ptr);
             break;
         case 20:
-            free_to_bucket<20>(raw_ptr);
+            free_to_bucket<20>(metadata, raw_ptr);
             break;
         case 21:
-            free_to_bucket<21>(raw_ptr);
+            free_to_bucket<21>(metadata, raw_ptr);
             break;
         case 22:
-            free_to_bucket<22>(raw_ptr);
+            free_to_bucket<22>(metadata, raw_ptr);
             break;
         case 23:
-            free_to_bucket<23>(raw_ptr);
+            free_to_bucket<23>(metadata, raw_ptr);
             break;
         case 24:
-            free_to_bucket<24>(raw_ptr);
+            free_to_bucket<24>(metadata, raw_ptr);
             break;
         case 25:
-            free_to_bucket<25>(raw_ptr);
+            free_to_bucket<25>(metadata, raw_ptr);
             break;
         case 26:
-            free_to_bucket<26>(raw_ptr);
+            free_to_bucket<26>(metadata, raw_ptr);
             break;
         case 27:
-            free_to_bucket<27>(raw_ptr);
+            free_to_bucket<27>(metadata, raw_ptr);
             break;
         default:
             SKL_ASSERT_PERMANENT(false && "Invalid bucket index");
@@ -4,6 +4,7 @@
 //! \license Licensed under the MIT License. See LICENSE for details.
 //!
 #include <cstdio>
+#include <cstdlib>
 #include <print>
 
 #include "skl_core"
@@ -24,16 +25,82 @@ thread_local bool g_is_skl_core_init_on_thread{false};
 //Set of available cores
 skl::cpu_indices_t g_skl_core_cpu_indices{};
 
+//Numa topology
+skl::numa_topology_t g_skl_core_numa_topology{};
+
 //Is the skl core initialized
 SKL_CACHE_ALIGNED std::relaxed_value<bool> g_is_skl_core_init{false};
 } // namespace
 
+namespace {
+//! Parse a sysfs cpu list ("0-3,8,10-11") and map the cpus to the given node
+void numa_map_cpu_list(const char* f_cpu_list, u8 f_node, skl::numa_topology_t& f_topology) noexcept {
+    const char* cursor = f_cpu_list;
+    while ('\0' != *cursor) {
+        char*     end   = nullptr;
+        const u64 first = ::strtoull(cursor, &end, 10);
+        if (end == cursor) {
+            return;
+        }
+
+        u64 last = first;
+        if ('-' == *end) {
+            cursor = end + 1;
+            last   = ::strtoull(cursor, &end, 10);
+            if (end == cursor) {
+                return;
+            }
+        }
+
+        for (u64 cpu = first; (cpu <= last) && (cpu < skl::CNumaMaxCpus); ++cpu) {
+            f_topology.m_cpu_to_node[cpu] = f_node;
+        }
+
+        cursor = end;
+        while ((',' == *cursor) || ('\n' == *cursor)) {
+            ++cursor;
+        }
+    }
+}
+
+//! Read the numa topology from /sys/devices/system/node (single node if not available)
+void numa_discover_topology(skl::numa_topology_t& f_topology) noexcept {
+    f_topology = {};
+
+    u32 nodes_count = 0U;
+    for (u32 node = 0U; node < skl::CNumaMaxNodes; ++node) {
+        char path[64];
+        (void)snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", node);
+
+        FILE* file = ::fopen(path, "r");
+        if (nullptr == file) {
+            continue;
+        }
+
+        char cpu_list[1024];
+        if (nullptr != ::fgets(cpu_list, sizeof(cpu_list), file)) {
+            numa_map_cpu_list(cpu_list, u8(node), f_topology);
+        }
+        (void)::fclose(file);
+
+        //Node ids can be sparse, keep them as indices
+        nodes_count = node + 1U;
+    }
+
+    f_topology.m_nodes_count = (0U == nodes_count) ? 1U : nodes_count;
+}
+} // namespace
+
 namespace skl {
 skl_status skl_core_init_thread__rand() noexcept;
 skl_status skl_core_deinit_thread__rand() noexcept;
 
 void skl_core_deinit_thread__slog() noexcept;
 void skl_core_deinit_thread__slog_bend() noexcept;
+
+void skl_core_deinit_thread__buffer_pool() noexcept;
+void skl_core_deinit_thread__perf() noexcept;
+void skl_core_deinit_thread__frame_arena() noexcept;
 } // namespace skl
 
 namespace skl {
@@ -48,6 +115,9 @@ skl_status skl_core_init() noexcept {
         puts("SKL_CORE: Huge pages not available");
     }
 
+    numa_discover_topology(g_skl_core_numa_topology);
+    std::print("SKL_CORE: Numa nodes: {}\n", g_skl_core_numa_topology.m_nodes_count);
+
     auto result = HugePageBufferPool::construct_pool();
     if (result.is_success()) {
         puts("SKL_CORE: Hugepage buffer pool initialized");
@@ -116,6 +186,9 @@ skl_status skl_core_deinit_thread() noexcept {
 
     skl_core_deinit_thread__slog_bend();
     skl_core_deinit_thread__slog();
+    skl_core_deinit_thread__buffer_pool();
+    skl_core_deinit_thread__perf();
+    skl_core_deinit_thread__frame_arena();
 
 #if 0
     puts("SKL_CORE_DEINIT_THREAD!");
@@ -142,4 +215,8 @@ skl_status skl_core_deinit() noexcept {
 const cpu_indices_t& skl_core_get_available_cpus() noexcept {
     return g_skl_core_cpu_indices;
 }
+
+const numa_topology_t& skl_core_get_numa_topology() noexcept {
+    return g_skl_core_numa_topology;
+}
 } // namespace skl
@@ -0,0 +1,147 @@
+//!
+//! \file skl_dod_fsm
+//!
+//! \brief DoD FSM parallel tick worker pool
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include "skl_dod_fsm"
+#include "skl_thread"
+#include "skl_core_info"
+#include "skl_log"
+
+namespace {
+//! [Const] No of pause spins before parking (workers and caller)
+constexpr u32 CWorkerSpinCount = 4096U;
+} // namespace
+
+namespace skl::dod_fsm {
+tick_worker_pool_t::tick_worker_pool_t() noexcept = default;
+
+tick_worker_pool_t::~tick_worker_pool_t() noexcept {
+    destroy();
+}
+
+skl_status tick_worker_pool_t::create(u32 f_workers_count, bool f_pin_workers) noexcept {
+    if (m_is_created) {
+        return SKL_ERR_STATE;
+    }
+
+    const auto& cpus = skl_core_get_available_cpus();
+    if (cpus.empty()) {
+        return SKL_ERR_INIT;
+    }
+
+    if (0U == f_workers_count) {
+        f_workers_count = u32(cpus.size());
+    }
+
+    if (f_workers_count > CMaxWorkers) {
+        return SKL_ERR_PARAMS;
+    }
+
+    m_stop.store_relaxed(0U);
+    m_pending.store_relaxed(0U);
+    m_workers_count = f_workers_count;
+    m_is_created    = true;
+
+    // The workers wait for the run after this generation (run() can be called before they start)
+    const u32 generation = m_generation.load_relaxed();
+
+    const auto result = start_worker_threads(m_threads, "dod-fsm-worker", f_workers_count, f_pin_workers, [this, generation](u32 f_worker_index) noexcept -> i32 {
+        return worker_main(f_worker_index, generation);
+    });
+    if (result.is_failure()) {
+        SERROR_LOCAL("tick_worker_pool_t::create() Failed to start the workers!");
+        destroy();
+        return SKL_ERR_FAIL;
+    }
+
+    return SKL_SUCCESS;
+}
+
+void tick_worker_pool_t::destroy() noexcept {
+    m_is_created = false;
+    if (m_threads.empty()) {
+        m_workers_count = 1U;
+        return;
+    }
+
+    m_stop.store_release(1U);
+    (void)m_generation.increment();
+    m_wake.wake_all();
+
+    join_worker_threads(m_threads);
+    m_workers_count = 1U;
+}
+
+void tick_worker_pool_t::run(task_t f_task, void* f_context) noexcept {
+    SKL_ASSERT(nullptr != f_task);
+
+    if (m_threads.empty()) {
+        f_task(f_context, 0U);
+        return;
+    }
+
+    m_task    = f_task;
+    m_context = f_context;
+    m_pending.store_relaxed(u32(m_threads.size()));
+
+    // Publish the task, wake the parked workers
+    (void)m_generation.increment();
+    m_wake.notify_all();
+
+    f_task(f_context, 0U);
+
+    // Wait for the workers, park after the spins (the last worker wakes the caller)
+    u32 spins = 0U;
+    while (0U != m_pending.load_acquire()) {
+        if (spins < CWorkerSpinCount) {
+            ++spins;
+            __builtin_ia32_pause();
+            continue;
+        }
+
+        const u32 ticket = m_done.prepare_park();
+        if (0U != m_pending.load_acquire()) {
+            m_done.park(ticket);
+        }
+        m_done.finish_park();
+    }
+}
+
+i32 tick_worker_pool_t::worker_main(u32 f_worker_index, u32 f_generation) noexcept {
+    u32 seen = f_generation;
+
+    for (;;) {
+        // Wait for the next run
+        u32 spins = 0U;
+        u32 generation;
+        while (seen == (generation = m_generation.load_acquire())) {
+            if (spins < CWorkerSpinCount) {
+                ++spins;
+                __builtin_ia32_pause();
+                continue;
+            }
+
+            const u32 ticket = m_wake.prepare_park();
+            if (seen == m_generation.load_acquire()) {
+                m_wake.park(ticket);
+            }
+            m_wake.finish_park();
+        }
+        seen = generation;
+
+        if (0U != m_stop.load_acquire()) {
+            break;
+        }
+
+        m_task(m_context, f_worker_index);
+        if (1U == m_pending.decrement()) {
+            m_done.notify_one();
+        }
+    }
+
+    return 0;
+}
+} // namespace skl::dod_fsm
@@ -0,0 +1,129 @@
+//!
+//! \file skl_frame_arena
+//!
+//! \brief Per thread frame arena
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include "skl_frame_arena"
+#include "skl_huge_pages"
+#include "skl_thread_id"
+#include "skl_stream"
+#include "skl_tls"
+#include "skl_log"
+
+SKL_MAKE_TLS_SINGLETON(skl::frame_arena_t, g_skl_frame_arena_tls);
+
+namespace skl {
+skl_status frame_arena_t::create(u64 f_capacity, bool f_use_huge_pages) noexcept {
+    if (is_valid()) {
+        return SKL_ERR_STATE;
+    }
+
+    if (0U == f_capacity) {
+        return SKL_ERR_PARAMS;
+    }
+
+    byte* base       = nullptr;
+    bool  huge_pages = false;
+
+    if (f_use_huge_pages && huge_pages::is_huge_pages_enabled()) {
+        const u64 page_count = huge_pages::bytes_to_page_count(f_capacity);
+        base                 = static_cast<byte*>(huge_pages::skl_huge_page_alloc(page_count));
+        if (nullptr != base) {
+            huge_pages = true;
+            f_capacity = huge_pages::page_count_to_bytes(page_count);
+        } else {
+            SWARNING_LOCAL("frame_arena_t::create({}) Failed to allocate huge pages, using regular pages!", f_capacity);
+        }
+    }
+
+    if (nullptr == base) {
+        base = static_cast<byte*>(skl_vector_alloc(f_capacity, SKL_CACHE_LINE_SIZE));
+        if (nullptr == base) {
+            SERROR_LOCAL("frame_arena_t::create({}) Failed to allocate the arena!", f_capacity);
+            return SKL_ERR_ALLOC;
+        }
+    }
+
+    m_base               = base;
+    m_head               = base;
+    m_end                = base + f_capacity;
+    m_high_water_mark    = 0U;
+    m_last_frame_used    = 0U;
+    m_frames_count       = 0U;
+    m_failed_allocations = 0U;
+    m_thread_id          = current_thread_id();
+    m_huge_pages         = huge_pages;
+
+    return SKL_SUCCESS;
+}
+
+void frame_arena_t::destroy() noexcept {
+    if (false == is_valid()) {
+        return;
+    }
+
+    if (m_huge_pages) {
+        huge_pages::skl_huge_page_free(m_base, huge_pages::bytes_to_page_count(capacity()));
+    } else {
+        skl_vector_free(m_base);
+    }
+
+    m_base       = nullptr;
+    m_head       = nullptr;
+    m_end        = nullptr;
+    m_huge_pages = false;
+}
+
+frame_arena_report_t frame_arena_t::report() const noexcept {
+    frame_arena_report_t result{};
+    result.m_capacity           = capacity();
+    result.m_used               = used();
+    result.m_high_water_mark    = high_water_mark();
+    result.m_last_frame_used    = m_last_frame_used;
+    result.m_frames_count       = m_frames_count;
+    result.m_failed_allocations = m_failed_allocations;
+    result.m_thread_id          = m_thread_id;
+    result.m_is_huge_pages      = m_huge_pages ? 1U : 0U;
+    return result;
+}
+
+bool frame_arena_t::write_report(skl_stream& f_stream) const noexcept {
+    return f_stream.write_safe(report());
+}
+
+skl_status skl_frame_arena_thread_init(u64 f_capacity, bool f_use_huge_pages) noexcept {
+    if (g_skl_frame_arena_tls::tls_init_status()) {
+        return SKL_OK_REDUNDANT;
+    }
+
+    auto result = g_skl_frame_arena_tls::tls_create();
+    if (result.is_failure()) {
+        return result;
+    }
+
+    result = g_skl_frame_arena_tls::tls_checked().create(f_capacity, f_use_huge_pages);
+    if (result.is_failure()) {
+        g_skl_frame_arena_tls::tls_destroy();
+    }
+
+    return result;
+}
+
+void skl_frame_arena_thread_deinit() noexcept {
+    g_skl_frame_arena_tls::tls_destroy();
+}
+
+bool skl_frame_arena_is_thread_init() noexcept {
+    return g_skl_frame_arena_tls::tls_init_status();
+}
+
+frame_arena_t& skl_frame_arena() noexcept {
+    return g_skl_frame_arena_tls::tls_checked();
+}
+
+void skl_core_deinit_thread__frame_arena() noexcept {
+    skl_frame_arena_thread_deinit();
+}
+} // namespace skl
@@ -4,6 +4,8 @@
 //! \license Licensed under the MIT License. See LICENSE for details.
 //!
 #include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
 #include <unistd.h>
 #include <cstdio>
 
@@ -12,6 +14,10 @@
 #include "skl_vector"
 #include "skl_core"
 
+#ifndef MADV_POPULATE_WRITE
+#    define MADV_POPULATE_WRITE 23 // Linux 5.14+
+#endif
+
 namespace {
 //! [Internal] Global flag indicating if huge pages are available
 bool g_huge_pages_available = false;
@@ -49,6 +55,32 @@ u64 read_system_huge_page_size() noexcept {
     // Convert from kB to bytes
     return hugepage_size_kb * 1024u;
 }
+
+//! [Internal] Map huge pages bound to the given numa node
+//! \return The mapped memory, or nullptr if the node could not be used
+void* map_huge_pages_on_node(u64 f_total_size, u32 f_numa_node) noexcept {
+    // Not populated yet, the policy must be in place before the pages are faulted in
+    void* ptr = ::mmap(nullptr, f_total_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (MAP_FAILED == ptr) {
+        return nullptr;
+    }
+
+    // Raw syscall, no libnuma dependency (maxnode + 1 as the kernel drops the last bit)
+    const u64 node_mask = u64(1u) << f_numa_node;
+    if (0 != ::syscall(SYS_mbind, ptr, f_total_size, MPOL_BIND, &node_mask, sizeof(node_mask) * 8u + 1u, 0u)) {
+        (void)::munmap(ptr, f_total_size);
+        return nullptr;
+    }
+
+    // Populate on the node, fails (instead of SIGBUS on first touch) if the node has no free huge pages
+    // Older kernels reject the advice, the caller falls back to unbound pages
+    if (0 != ::madvise(ptr, f_total_size, MADV_POPULATE_WRITE)) {
+        (void)::munmap(ptr, f_total_size);
+        return nullptr;
+    }
+
+    return ptr;
+}
 } // namespace
 
 namespace skl::huge_pages {
@@ -119,6 +151,20 @@ void* skl_huge_page_alloc(u64 f_page_count) noexcept {
 #endif
 }
 
+void* skl_huge_page_alloc_on_node(u64 f_page_count, u32 f_numa_node) noexcept {
+    SKL_ASSERT_CRITICAL(skl_core_is_initialized());
+    SKL_ASSERT_PERMANENT(f_page_count > 0u);
+
+    if (is_huge_pages_enabled() && (f_numa_node < 64u)) {
+        void* ptr = map_huge_pages_on_node(f_page_count * CHugePageSize, f_numa_node);
+        if (nullptr != ptr) {
+            return ptr;
+        }
+    }
+
+    return skl_huge_page_alloc(f_page_count);
+}
+
 void skl_huge_page_free(void* f_ptr, u64 f_page_count) noexcept {
 #if defined(SKL_CORE_FORCE_HUGEPAGE_SUPPORT)
     if (nullptr == f_ptr) {
@@ -0,0 +1,271 @@
+//!
+//! \file skl_job_system
+//!
+//! \brief Work stealing job system
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include "skl_job_system"
+#include "skl_thread"
+#include "skl_core_info"
+#include "skl_vector_allocator"
+#include "skl_log"
+
+namespace skl {
+//! Per worker state
+struct alignas(SKL_CACHE_LINE_SIZE) job_worker_t {
+    job_system_t::deque_t m_deque;                             //!< {Owner -> Thieves} Queued jobs
+    job_t                 m_jobs[job_system_t::CJobPoolSize]; //!< Jobs pool (ring)
+    job_system_t*         m_system{nullptr};                  //!< Owner system
+    u32                   m_next_job{0U};                     //!< Next pool slot
+    u32                   m_index{0U};                        //!< Worker index
+    u32                   m_steal_seed{0U};                   //!< Victim selection rng state (xorshift32)
+};
+} // namespace skl
+
+namespace {
+//! [ThreadLocal] Calling thread's worker (nullptr if not part of a job system)
+thread_local skl::job_worker_t* t_job_worker{nullptr};
+
+//! Futex word of the job's unfinished counter
+[[nodiscard]] u32* job_system_unfinished_word(const skl::job_t* f_job) noexcept {
+    return reinterpret_cast<u32*>(const_cast<skl::job_t*>(f_job)->m_unfinished.unsafe_ptr());
+}
+
+[[nodiscard]] u32 job_system_next_victim(skl::job_worker_t& f_worker) noexcept {
+    u32 x = f_worker.m_steal_seed;
+    x ^= x << 13U;
+    x ^= x >> 17U;
+    x ^= x << 5U;
+    f_worker.m_steal_seed = x;
+    return x;
+}
+} // namespace
+
+namespace skl {
+job_system_t::job_system_t() noexcept = default;
+
+job_system_t::~job_system_t() noexcept {
+    destroy();
+}
+
+skl_status job_system_t::create(const job_system_config_t& f_config) noexcept {
+    if (is_created() || (nullptr != t_job_worker)) {
+        return SKL_ERR_STATE;
+    }
+
+    const auto& cpus = skl_core_get_available_cpus();
+    if (cpus.empty()) {
+        return SKL_ERR_INIT;
+    }
+
+    const u32 workers_count = (0U == f_config.m_workers_count) ? u32(cpus.size()) : f_config.m_workers_count;
+    if (workers_count > CMaxWorkers) {
+        return SKL_ERR_PARAMS;
+    }
+
+    if (EJobWorkerPinning::All == f_config.m_pinning) {
+        const i16 cpu = i16(cpus[0U]);
+        if (SKLThread::set_thread_affinity({cpu, cpu}).is_failure()) {
+            SERROR_LOCAL("job_system_t::create() Failed to pin the creator thread to cpu {}!", cpu);
+            return SKL_ERR_FAIL;
+        }
+    }
+
+    auto* workers = reinterpret_cast<job_worker_t*>(skl_core_alloc(sizeof(job_worker_t) * workers_count, alignof(job_worker_t)));
+    if (nullptr == workers) {
+        return SKL_ERR_ALLOC;
+    }
+
+    for (u32 i = 0U; i < workers_count; ++i) {
+        auto* worker         = new (workers + i) job_worker_t();
+        worker->m_system     = this;
+        worker->m_index      = i;
+        worker->m_steal_seed = 0x9E3779B9U * (i + 1U);
+    }
+
+    m_stop.store_relaxed(0U);
+    m_workers         = workers;
+    m_workers_count   = workers_count;
+    m_idle_spin_count = f_config.m_idle_spin_count;
+    t_job_worker      = &m_workers[0U];
+
+    const bool pin    = EJobWorkerPinning::None != f_config.m_pinning;
+    const auto result = start_worker_threads(m_threads, "job-worker", workers_count, pin, [this](u32 f_worker_index) noexcept -> i32 {
+        return worker_main(f_worker_index);
+    });
+    if (result.is_failure()) {
+        SERROR_LOCAL("job_system_t::create() Failed to start the workers!");
+        destroy();
+        return SKL_ERR_FAIL;
+    }
+
+    return SKL_SUCCESS;
+}
+
+void job_system_t::destroy() noexcept {
+    if (false == is_created()) {
+        return;
+    }
+
+    m_stop.store_release(1U);
+    m_wake.wake_all();
+    join_worker_threads(m_threads);
+
+    if (t_job_worker == &m_workers[0U]) {
+        t_job_worker = nullptr;
+    }
+
+    for (u32 i = 0U; i < m_workers_count; ++i) {
+        m_workers[i].~job_worker_t();
+    }
+    skl_core_free(m_workers);
+
+    m_workers       = nullptr;
+    m_workers_count = 1U;
+}
+
+u32 job_system_t::current_worker_index() const noexcept {
+    SKL_ASSERT((nullptr != t_job_worker) && (this == t_job_worker->m_system));
+    return t_job_worker->m_index;
+}
+
+job_t* job_system_t::allocate_job() noexcept {
+    SKL_ASSERT((nullptr != t_job_worker) && (this == t_job_worker->m_system));
+
+    auto& worker = *t_job_worker;
+    for (;;) {
+        // Next finished slot, skips the long lived jobs (eg. parents still waiting for children)
+        for (u32 i = 0U; i < CJobPoolSize; ++i) {
+            job_t* job = &worker.m_jobs[worker.m_next_job++ & (CJobPoolSize - 1U)];
+            if (job->is_finished()) [[likely]] {
+                return job;
+            }
+        }
+
+        // All CJobPoolSize jobs of this worker are in flight, help
+        if (job_t* job = get_job(worker); nullptr != job) {
+            execute(job);
+        } else {
+            __builtin_ia32_pause();
+        }
+    }
+}
+
+void job_system_t::run(job_t* f_job) noexcept {
+    SKL_ASSERT((nullptr != t_job_worker) && (this == t_job_worker->m_system));
+    SKL_ASSERT(nullptr != f_job);
+
+    if (false == t_job_worker->m_deque.push(f_job)) [[unlikely]] {
+        execute(f_job);
+        return;
+    }
+
+    m_wake.notify_one();
+}
+
+void job_system_t::wait(const job_t* f_job) noexcept {
+    SKL_ASSERT((nullptr != t_job_worker) && (this == t_job_worker->m_system));
+
+    auto& worker = *t_job_worker;
+    u32   spins  = 0U;
+    while (false == f_job->is_finished()) {
+        if (job_t* job = get_job(worker); nullptr != job) {
+            execute(job);
+            spins = 0U;
+        } else if (spins < m_idle_spin_count) {
+            ++spins;
+            __builtin_ia32_pause();
+        } else {
+            // Nothing to run, the rest of the job runs on other workers, park until its counter changes (execute() wakes at zero)
+            m_waiters.enter();
+            const i32 unfinished = f_job->m_unfinished.load_acquire();
+            if (0 != unfinished) {
+                futex_wait(job_system_unfinished_word(f_job), u32(unfinished));
+            }
+            m_waiters.leave();
+            spins = 0U;
+        }
+    }
+}
+
+job_t* job_system_t::get_job(job_worker_t& f_worker) noexcept {
+    if (job_t* job = f_worker.m_deque.pop(); nullptr != job) {
+        return job;
+    }
+
+    const u32 workers_count = m_workers_count;
+    if (1U == workers_count) {
+        return nullptr;
+    }
+
+    // Try all the other workers, starting from a random one
+    u32 victim = job_system_next_victim(f_worker) % workers_count;
+    for (u32 i = 0U; i < workers_count; ++i) {
+        if (victim != f_worker.m_index) {
+            if (job_t* job = m_workers[victim].m_deque.steal(); nullptr != job) {
+                return job;
+            }
+        }
+        victim = ((victim + 1U) == workers_count) ? 0U : (victim + 1U);
+    }
+
+    return nullptr;
+}
+
+void job_system_t::execute(job_t* f_job) noexcept {
+    f_job->m_invoke(*f_job);
+
+    // Finish the job and every parent whose last child it was (the parent is read before the job slot can be reused)
+    while (nullptr != f_job) {
+        job_t* parent = f_job->m_parent;
+        if (1 != f_job->m_unfinished.decrement()) {
+            break;
+        }
+        if (m_waiters.any()) [[unlikely]] {
+            futex_wake_all(job_system_unfinished_word(f_job));
+        }
+        f_job = parent;
+    }
+}
+
+i32 job_system_t::worker_main(u32 f_worker_index) noexcept {
+    auto& worker = m_workers[f_worker_index];
+    t_job_worker = &worker;
+
+    u32 spins = 0U;
+    for (;;) {
+        if (job_t* job = get_job(worker); nullptr != job) {
+            execute(job);
+            spins = 0U;
+            continue;
+        }
+
+        if (0U != m_stop.load_acquire()) {
+            break;
+        }
+
+        if (spins < m_idle_spin_count) {
+            ++spins;
+            __builtin_ia32_pause();
+            continue;
+        }
+
+        // Park, run() wakes one parked worker
+        const u32 ticket = m_wake.prepare_park();
+        job_t*    job    = get_job(worker);
+        if ((nullptr == job) && (0U == m_stop.load_acquire())) {
+            m_wake.park(ticket);
+        }
+        m_wake.finish_park();
+
+        if (nullptr != job) {
+            execute(job);
+        }
+        spins = 0U;
+    }
+
+    t_job_worker = nullptr;
+    return 0;
+}
+} // namespace skl
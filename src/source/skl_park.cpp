@@ -0,0 +1,70 @@
+//!
+//! \file skl_park
+//!
+//! \brief Spin-then-park building blocks shared by the worker pools
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#include <cstdio>
+
+#include "skl_park"
+#include "skl_thread"
+#include "skl_core_info"
+#include "skl_log"
+
+namespace skl {
+void futex_wait(u32* f_word, u32 f_expected) noexcept {
+    (void)::syscall(SYS_futex, f_word, FUTEX_WAIT_PRIVATE, f_expected, nullptr, nullptr, 0);
+}
+
+void futex_wake(u32* f_word, i32 f_count) noexcept {
+    (void)::syscall(SYS_futex, f_word, FUTEX_WAKE_PRIVATE, f_count, nullptr, nullptr, 0);
+}
+
+void futex_wake_all(u32* f_word) noexcept {
+    futex_wake(f_word, INT_MAX);
+}
+
+skl_status start_worker_threads(std::vector<std::unique_ptr<SKLThread>>& f_threads,
+                                const char*                              f_name,
+                                u32                                      f_workers_count,
+                                bool                                     f_pin,
+                                const worker_thread_main_t&              f_main) noexcept {
+    const auto& cpus = skl_core_get_available_cpus();
+    if (cpus.empty()) {
+        return SKL_ERR_INIT;
+    }
+
+    for (u32 i = 1U; i < f_workers_count; ++i) {
+        char name[32U];
+        (void)std::snprintf(name, sizeof(name), "%s-%u", f_name, i);
+
+        auto thread = std::make_unique<SKLThread>(skl_string_view::from_cstr(name));
+        thread->set_handler([f_main, i]() noexcept -> i32 {
+            return f_main(i);
+        });
+
+        const i16  cpu    = f_pin ? i16(cpus[i % u32(cpus.size())]) : i16(-1);
+        const auto result = thread->create({cpu, cpu});
+        if (result.is_failure()) {
+            SERROR_LOCAL("start_worker_threads() Failed to start worker {}-{}!", f_name, i);
+            return SKL_ERR_FAIL;
+        }
+
+        f_threads.push_back(std::move(thread));
+    }
+
+    return SKL_SUCCESS;
+}
+
+void join_worker_threads(std::vector<std::unique_ptr<SKLThread>>& f_threads) noexcept {
+    for (auto& thread : f_threads) {
+        (void)thread->join();
+    }
+    f_threads.clear();
+}
+} // namespace skl
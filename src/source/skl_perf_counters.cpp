@@ -0,0 +1,240 @@
+//!
+//! \file skl_perf_counters
+//!
+//! \brief Hardware performance counters (perf_event_open) and scoped profiling regions
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <ctime>
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include "skl_perf_counters"
+#include "skl_tls"
+#include "skl_assert"
+
+namespace {
+struct perf_counter_desc_t {
+    u32         m_type;
+    u64         m_config;
+    const char* m_name;
+};
+
+constexpr u64 perf_hw_cache_config(u64 f_cache, u64 f_op, u64 f_result) noexcept {
+    return f_cache | (f_op << 8U) | (f_result << 16U);
+}
+
+//! Indexed by EPerfCounter
+constexpr perf_counter_desc_t CPerfCounterDescs[skl::CPerfCountersCount]{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+    {PERF_TYPE_HW_CACHE, perf_hw_cache_config(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), "l1d_misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "llc_misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch_misses"},
+    {PERF_TYPE_HW_CACHE, perf_hw_cache_config(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS), "dtlb_misses"},
+};
+
+//! PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING layout
+struct perf_group_read_t {
+    u64 m_count;
+    u64 m_time_enabled;
+    u64 m_time_running;
+    u64 m_values[skl::CPerfCountersCount];
+};
+
+[[nodiscard]] i32 perf_event_open(perf_event_attr& f_attr, i32 f_group_fd) noexcept {
+    return i32(syscall(SYS_perf_event_open, &f_attr, 0 /*calling thread*/, -1 /*any cpu*/, f_group_fd, PERF_FLAG_FD_CLOEXEC));
+}
+
+[[nodiscard]] u64 monotonic_ns() noexcept {
+    timespec now{};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return (u64(now.tv_sec) * 1'000'000'000ULL) + u64(now.tv_nsec);
+}
+} // namespace
+
+namespace skl {
+const char* skl_perf_counter_name(EPerfCounter f_counter) noexcept {
+    if (f_counter >= EPerfCounter::Max) {
+        return "unknown";
+    }
+    return CPerfCounterDescs[u32(f_counter)].m_name;
+}
+
+skl_status SKLPerfCounters::open() noexcept {
+    if (is_open()) {
+        return SKL_OK_REDUNDANT;
+    }
+
+    m_available_mask = 0U;
+    m_opened_count   = 0U;
+
+    for (u32 i = 0U; i < CPerfCountersCount; ++i) {
+        perf_event_attr attr{};
+        attr.size           = sizeof(perf_event_attr);
+        attr.type           = CPerfCounterDescs[i].m_type;
+        attr.config         = CPerfCounterDescs[i].m_config;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.disabled       = (-1 == m_group_fd) ? 1U : 0U; //The leader starts the whole group
+        attr.exclude_kernel = 1U;                           //Allowed with perf_event_paranoid <= 2
+        attr.exclude_hv     = 1U;
+
+        const i32 fd = perf_event_open(attr, m_group_fd);
+        if (-1 == fd) {
+            //Not supported by the PMU, not permitted or no PMU at all (eg. containers, some VMs)
+            continue;
+        }
+
+        if (-1 == m_group_fd) {
+            m_group_fd = fd;
+        }
+
+        m_fds[i]         = fd;
+        m_group_index[i] = u8(m_opened_count++);
+        m_available_mask |= (1U << i);
+    }
+
+    if (-1 == m_group_fd) {
+        return SKL_ERR_DEVICE;
+    }
+
+    if ((0 != ioctl(m_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP))
+        || (0 != ioctl(m_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP))) {
+        close();
+        return SKL_ERR_DEVICE;
+    }
+
+    return SKL_SUCCESS;
+}
+
+void SKLPerfCounters::close() noexcept {
+    if (false == is_open()) {
+        return;
+    }
+
+    (void)ioctl(m_group_fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    //Close the members first
+    for (u32 i = 0U; i < CPerfCountersCount; ++i) {
+        if ((0U != (m_available_mask & (1U << i))) && (m_fds[i] != m_group_fd)) {
+            (void)::close(m_fds[i]);
+        }
+    }
+    (void)::close(m_group_fd);
+
+    m_group_fd       = -1;
+    m_available_mask = 0U;
+    m_opened_count   = 0U;
+}
+
+perf_counters_t SKLPerfCounters::read() const noexcept {
+    perf_counters_t result{};
+    result.m_time_ns = monotonic_ns();
+
+    if (false == is_open()) {
+        return result;
+    }
+
+    perf_group_read_t group{};
+    const auto        read_bytes = ::read(m_group_fd, &group, sizeof(group));
+    if ((read_bytes < i64(sizeof(u64) * 3U)) || (group.m_count != m_opened_count) || (0U == group.m_time_running)) {
+        //Not scheduled (yet) or failed, no counter value is valid
+        return result;
+    }
+
+    //Scale if the group was multiplexed with other events
+    const bool   multiplexed = group.m_time_running < group.m_time_enabled;
+    const double scale       = multiplexed ? (double(group.m_time_enabled) / double(group.m_time_running)) : 1.0;
+
+    for (u32 i = 0U; i < CPerfCountersCount; ++i) {
+        if (0U != (m_available_mask & (1U << i))) {
+            const u64 value    = group.m_values[m_group_index[i]];
+            result.m_values[i] = multiplexed ? u64(double(value) * scale) : value;
+        }
+    }
+    result.m_available_mask = m_available_mask;
+
+    return result;
+}
+} // namespace skl
+
+namespace {
+//! Thread local perf state, counters + scope records ring
+struct perf_thread_state_t {
+    skl::SKLPerfCounters     m_counters{};
+    bool                     m_open_attempted{false};
+    u64                      m_head{0U};        //!< Next record to write
+    u64                      m_tail{0U};        //!< Oldest record not drained
+    u64                      m_overwritten{0U}; //!< No of records overwritten before being drained
+    skl::perf_scope_record_t m_records[skl::CPerfScopeThreadBufferSize];
+
+    static_assert((skl::CPerfScopeThreadBufferSize > 0U) && (0U == (skl::CPerfScopeThreadBufferSize & (skl::CPerfScopeThreadBufferSize - 1U))),
+                  "CPerfScopeThreadBufferSize must be a power of 2");
+
+    void tls_destroy() noexcept {
+        m_counters.close();
+    }
+};
+} // namespace
+
+SKL_MAKE_TLS_SINGLETON(perf_thread_state_t, g_skl_perf_tls);
+
+namespace {
+[[nodiscard]] perf_thread_state_t& perf_thread_state() noexcept {
+    auto& state = g_skl_perf_tls::tls_guarded();
+    if (false == state.m_open_attempted) [[unlikely]] {
+        //Missing counters are not an error, only the wall time is recorded
+        state.m_open_attempted = true;
+        (void)state.m_counters.open();
+    }
+    return state;
+}
+} // namespace
+
+namespace skl {
+perf_counters_t skl_perf_thread_read() noexcept {
+    return perf_thread_state().m_counters.read();
+}
+
+u32 skl_perf_thread_available_mask() noexcept {
+    return perf_thread_state().m_counters.available_mask();
+}
+
+void skl_perf_scope_record(const char* f_name, const perf_counters_t& f_start) noexcept {
+    auto& state = perf_thread_state();
+
+    const auto end = state.m_counters.read();
+
+    if ((state.m_head - state.m_tail) == CPerfScopeThreadBufferSize) {
+        ++state.m_tail;
+        ++state.m_overwritten;
+    }
+
+    auto& record   = state.m_records[state.m_head & (CPerfScopeThreadBufferSize - 1U)];
+    record.m_name  = f_name;
+    record.m_delta = end - f_start;
+    ++state.m_head;
+}
+
+u32 skl_perf_scope_drain(perf_scope_record_t* f_out_records, u32 f_max_count) noexcept {
+    auto& state = perf_thread_state();
+
+    u32 count = 0U;
+    for (; (count < f_max_count) && (state.m_tail != state.m_head); ++count, ++state.m_tail) {
+        f_out_records[count] = state.m_records[state.m_tail & (CPerfScopeThreadBufferSize - 1U)];
+    }
+
+    return count;
+}
+
+u64 skl_perf_scope_overwritten_count() noexcept {
+    return perf_thread_state().m_overwritten;
+}
+
+void skl_core_deinit_thread__perf() noexcept {
+    g_skl_perf_tls::tls_destroy();
+}
+} // namespace skl
@@ -0,0 +1,83 @@
+//!
+//! \file skl_ring_notifier
+//!
+//! \brief Futex and eventfd ring notifiers
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <ctime>
+
+#include "skl_ring_notifier"
+#include "skl_log"
+
+namespace {
+[[nodiscard]] timespec ring_notifier_timeout(u32 f_timeout_ms) noexcept {
+    timespec result{};
+    result.tv_sec  = time_t(f_timeout_ms / 1000U);
+    result.tv_nsec = long(f_timeout_ms % 1000U) * 1000000L;
+    return result;
+}
+} // namespace
+
+namespace skl {
+void ring_futex_notifier_t::wait(u32 f_timeout_ms) noexcept {
+    const timespec timeout = ring_notifier_timeout(f_timeout_ms);
+
+    // Returns immediately (EAGAIN) if the producer already reset the word
+    (void)::syscall(SYS_futex, m_armed.unsafe_ptr(), FUTEX_WAIT_PRIVATE, 1U, (CRingWaitInfinite == f_timeout_ms) ? nullptr : &timeout, nullptr, 0);
+}
+
+void ring_futex_notifier_t::wake() noexcept {
+    if (0U != m_armed.exchange(0U)) {
+        (void)::syscall(SYS_futex, m_armed.unsafe_ptr(), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    }
+}
+
+skl_status ring_eventfd_notifier_t::create() noexcept {
+    if (-1 != m_fd) {
+        return SKL_ERR_STATE;
+    }
+
+    m_fd = ::eventfd(0U, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (-1 == m_fd) {
+        SERROR_LOCAL("ring_eventfd_notifier_t::create() eventfd failed!");
+        return SKL_ERR_FAIL;
+    }
+
+    m_armed.store_relaxed(0U);
+    return SKL_SUCCESS;
+}
+
+void ring_eventfd_notifier_t::destroy() noexcept {
+    if (-1 != m_fd) {
+        (void)::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+void ring_eventfd_notifier_t::disarm() noexcept {
+    m_armed.store_relaxed(0U);
+
+    // Consume the pending notification so the fd is not readable anymore
+    eventfd_t value = 0U;
+    (void)::eventfd_read(m_fd, &value);
+}
+
+void ring_eventfd_notifier_t::wait(u32 f_timeout_ms) noexcept {
+    pollfd poll_fd{};
+    poll_fd.fd     = m_fd;
+    poll_fd.events = POLLIN;
+    (void)::poll(&poll_fd, 1U, (CRingWaitInfinite == f_timeout_ms) ? -1 : i32(f_timeout_ms));
+}
+
+void ring_eventfd_notifier_t::wake() noexcept {
+    if (0U != m_armed.exchange(0U)) {
+        (void)::eventfd_write(m_fd, 1U);
+    }
+}
+} // namespace skl
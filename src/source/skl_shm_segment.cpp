@@ -0,0 +1,286 @@
+//!
+//! \file skl_shm_segment
+//!
+//! \brief Named shared memory segment
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <linux/magic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include "skl_shm_segment"
+#include "skl_huge_pages"
+#include "skl_utility"
+#include "skl_log"
+
+namespace {
+[[nodiscard]] bool shm_segment_is_valid_name(const char* f_name) noexcept {
+    if (nullptr == f_name) {
+        return false;
+    }
+
+    const u64 length = std::strlen(f_name);
+    return (0U < length) && (length <= skl::shm_segment_t::CMaxNameLength) && (nullptr == std::strchr(f_name, '/'));
+}
+
+//! Build the hugetlbfs file path of the segment
+void shm_segment_huge_path(const char* f_name, char (&f_out_path)[256U]) noexcept {
+    (void)std::snprintf(f_out_path, sizeof(f_out_path), "%s/%s", skl::shm_segment_t::CHugeTlbFsMount, f_name);
+}
+
+//! Build the shm_open name of the segment
+void shm_segment_shm_name(const char* f_name, char (&f_out_name)[256U]) noexcept {
+    (void)std::snprintf(f_out_name, sizeof(f_out_name), "/%s", f_name);
+}
+
+//! [Const] Magic of the locator record
+constexpr u64 CShmSegmentLocatorMagic = 0x534B4C4855474550ULL; // "SKLHUGEP"
+
+//! Content of the posix shm object of a hugetlbfs backed segment (the shm name is the only name registry)
+//! \remark Its size (not a page multiple) tells it apart from a posix shm backed segment
+struct shm_segment_locator_t {
+    u64 m_magic; //!< CShmSegmentLocatorMagic
+};
+
+//! Is the open posix shm object \p f_fd of \p f_size bytes the locator of a hugetlbfs backed segment
+[[nodiscard]] bool shm_segment_is_locator(i32 f_fd, u64 f_size) noexcept {
+    if (sizeof(shm_segment_locator_t) != f_size) {
+        return false;
+    }
+
+    shm_segment_locator_t locator{};
+    return (ssize_t(sizeof(locator)) == ::pread(f_fd, &locator, sizeof(locator), 0)) && (CShmSegmentLocatorMagic == locator.m_magic);
+}
+
+//! Is the hugetlbfs mount available
+[[nodiscard]] bool shm_segment_has_hugetlbfs() noexcept {
+    struct statfs info{};
+    return (0 == ::statfs(skl::shm_segment_t::CHugeTlbFsMount, &info)) && (HUGETLBFS_MAGIC == u64(info.f_type));
+}
+
+[[nodiscard]] flock shm_segment_lock_desc(short f_type, u32 f_index) noexcept {
+    flock result{};
+    result.l_type   = f_type;
+    result.l_whence = SEEK_SET;
+    result.l_start  = off_t(f_index);
+    result.l_len    = 1;
+    result.l_pid    = 0;
+    return result;
+}
+} // namespace
+
+namespace skl {
+skl_status shm_segment_t::create(const char* f_name, u64 f_size, bool f_use_huge_pages) noexcept {
+    if (is_open()) {
+        return SKL_ERR_STATE;
+    }
+
+    if ((false == shm_segment_is_valid_name(f_name)) || (0U == f_size)) {
+        return SKL_ERR_PARAMS;
+    }
+
+    // The posix shm name is taken first, it is the name registry for both backings
+    char path[256U];
+    shm_segment_shm_name(f_name, path);
+    const i32 shm_fd = ::shm_open(path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (-1 == shm_fd) {
+        if (EEXIST == errno) {
+            return SKL_ERR_EXISTING;
+        }
+        SERROR_LOCAL("shm_segment_t::create({}) shm_open failed errno={}!", f_name, errno);
+        return SKL_ERR_ALLOC;
+    }
+
+    if (f_use_huge_pages && huge_pages::is_huge_pages_enabled() && shm_segment_has_hugetlbfs()) {
+        // A hugetlbfs file without a locator was left behind by a failed create(), it is not registered
+        shm_segment_huge_path(f_name, path);
+        (void)::unlink(path);
+
+        const i32 fd = ::open(path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if (-1 != fd) {
+            const u64 huge_size = integral_ceil(f_size, huge_pages::CHugePageSize) * huge_pages::CHugePageSize;
+            if (0 != ::ftruncate(fd, off_t(huge_size))) {
+                // Could not size the hugetlbfs file, fall back to posix shm
+                (void)::close(fd);
+                (void)::unlink(path);
+            } else {
+                const shm_segment_locator_t locator{.m_magic = CShmSegmentLocatorMagic};
+                if (ssize_t(sizeof(locator)) != ::pwrite(shm_fd, &locator, sizeof(locator), 0)) {
+                    SERROR_LOCAL("shm_segment_t::create({}) Failed to write the locator errno={}!", f_name, errno);
+                    (void)::close(fd);
+                    (void)::close(shm_fd);
+                    (void)::unlink(path);
+                    shm_segment_shm_name(f_name, path);
+                    (void)::shm_unlink(path);
+                    return SKL_ERR_ALLOC;
+                }
+
+                (void)::close(shm_fd);
+                const auto result = map(fd, huge_size, true, true, f_name);
+                if (result.is_failure()) {
+                    shm_segment_t::unlink(f_name);
+                }
+                return result;
+            }
+        }
+    }
+
+    const u64 page_size = u64(::sysconf(_SC_PAGESIZE));
+    f_size              = integral_ceil(f_size, page_size) * page_size;
+
+    if (0 != ::ftruncate(shm_fd, off_t(f_size))) {
+        SERROR_LOCAL("shm_segment_t::create({}) ftruncate({}) failed errno={}!", f_name, f_size, errno);
+        (void)::close(shm_fd);
+        shm_segment_shm_name(f_name, path);
+        (void)::shm_unlink(path);
+        return SKL_ERR_ALLOC;
+    }
+
+    const auto result = map(shm_fd, f_size, false, true, f_name);
+    if (result.is_failure()) {
+        shm_segment_shm_name(f_name, path);
+        (void)::shm_unlink(path);
+    }
+
+    return result;
+}
+
+skl_status shm_segment_t::open(const char* f_name) noexcept {
+    if (is_open()) {
+        return SKL_ERR_STATE;
+    }
+
+    if (false == shm_segment_is_valid_name(f_name)) {
+        return SKL_ERR_PARAMS;
+    }
+
+    char path[256U];
+    shm_segment_shm_name(f_name, path);
+    i32 fd = ::shm_open(path, O_RDWR | O_CLOEXEC, 0600);
+    if (-1 == fd) {
+        return (ENOENT == errno) ? SKL_ERR_NOT_FOUND : SKL_ERR_ALLOC;
+    }
+
+    struct stat info{};
+    if ((0 != ::fstat(fd, &info)) || (0 >= info.st_size)) {
+        (void)::close(fd);
+        return SKL_ERR_NOT_FOUND;
+    }
+
+    // Hugetlbfs backed, open the file the locator points to
+    const bool huge_pages = shm_segment_is_locator(fd, u64(info.st_size));
+    if (huge_pages) {
+        (void)::close(fd);
+
+        shm_segment_huge_path(f_name, path);
+        fd = ::open(path, O_RDWR | O_CLOEXEC);
+        if (-1 == fd) {
+            return (ENOENT == errno) ? SKL_ERR_NOT_FOUND : SKL_ERR_ALLOC;
+        }
+
+        if ((0 != ::fstat(fd, &info)) || (0 >= info.st_size)) {
+            (void)::close(fd);
+            return SKL_ERR_NOT_FOUND;
+        }
+    }
+
+    return map(fd, u64(info.st_size), huge_pages, false, f_name);
+}
+
+skl_status shm_segment_t::map(i32 f_fd, u64 f_size, bool f_huge_pages, bool f_owner, const char* f_name) noexcept {
+    void* data = ::mmap(nullptr, f_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, f_fd, 0);
+    if (MAP_FAILED == data) {
+        SERROR_LOCAL("shm_segment_t::map({}) mmap({}) failed errno={}!", f_name, f_size, errno);
+        (void)::close(f_fd);
+        return SKL_ERR_ALLOC;
+    }
+
+    m_data       = static_cast<byte*>(data);
+    m_size       = f_size;
+    m_fd         = f_fd;
+    m_huge_pages = f_huge_pages;
+    m_owner      = f_owner;
+    (void)std::snprintf(m_name, sizeof(m_name), "%s", f_name);
+
+    return SKL_SUCCESS;
+}
+
+void shm_segment_t::close() noexcept {
+    if (false == is_open()) {
+        return;
+    }
+
+    (void)::munmap(m_data, m_size);
+    (void)::close(m_fd);
+
+    if (m_owner) {
+        // Remove only the backing this segment was created with
+        char path[256U];
+        if (m_huge_pages) {
+            shm_segment_huge_path(m_name, path);
+            (void)::unlink(path);
+        }
+        shm_segment_shm_name(m_name, path);
+        (void)::shm_unlink(path);
+    }
+
+    m_data       = nullptr;
+    m_size       = 0U;
+    m_fd         = -1;
+    m_huge_pages = false;
+    m_owner      = false;
+    m_name[0U]   = '\0';
+}
+
+void shm_segment_t::unlink(const char* f_name) noexcept {
+    if (false == shm_segment_is_valid_name(f_name)) {
+        return;
+    }
+
+    char path[256U];
+    shm_segment_shm_name(f_name, path);
+    const i32 fd = ::shm_open(path, O_RDONLY | O_CLOEXEC, 0600);
+    if (-1 == fd) {
+        return;
+    }
+
+    // The hugetlbfs file is removed only if the name is registered as hugetlbfs backed
+    struct stat info{};
+    if ((0 == ::fstat(fd, &info)) && shm_segment_is_locator(fd, u64(info.st_size))) {
+        shm_segment_huge_path(f_name, path);
+        (void)::unlink(path);
+        shm_segment_shm_name(f_name, path);
+    }
+    (void)::close(fd);
+
+    (void)::shm_unlink(path);
+}
+
+bool shm_segment_t::try_lock(u32 f_index) noexcept {
+    SKL_ASSERT(is_open());
+    auto lock = shm_segment_lock_desc(F_WRLCK, f_index);
+    return 0 == ::fcntl(m_fd, F_OFD_SETLK, &lock);
+}
+
+void shm_segment_t::unlock(u32 f_index) noexcept {
+    SKL_ASSERT(is_open());
+    auto lock = shm_segment_lock_desc(F_UNLCK, f_index);
+    (void)::fcntl(m_fd, F_OFD_SETLK, &lock);
+}
+
+bool shm_segment_t::is_locked_by_other(u32 f_index) const noexcept {
+    SKL_ASSERT(is_open());
+    auto lock = shm_segment_lock_desc(F_WRLCK, f_index);
+    if (0 != ::fcntl(m_fd, F_OFD_GETLK, &lock)) {
+        return false;
+    }
+    return F_UNLCK != lock.l_type;
+}
+} // namespace skl
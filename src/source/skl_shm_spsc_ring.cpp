@@ -0,0 +1,158 @@
+//!
+//! \file skl_shm_spsc_ring
+//!
+//! \brief Shared memory ring segment management
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <new>
+
+#include "skl_shm_spsc_ring"
+#include "skl_log"
+
+namespace {
+//! [Const] Header state once fully initialized
+constexpr u32 CShmRingReady = 1U;
+
+[[nodiscard]] u32 shm_ring_peer_role_index(skl::EShmRingRole f_role) noexcept {
+    return (skl::EShmRingRole::Producer == f_role) ? u32(skl::EShmRingRole::Consumer) : u32(skl::EShmRingRole::Producer);
+}
+} // namespace
+
+namespace skl {
+u64 shm_ring_channel_t::objects_offset(const layout_t& f_layout) noexcept {
+    const u64 alignment = (f_layout.m_object_alignment > u64(SKL_CACHE_LINE_SIZE)) ? f_layout.m_object_alignment : u64(SKL_CACHE_LINE_SIZE);
+    return ((sizeof(shm_ring_header_t) + alignment - 1U) / alignment) * alignment;
+}
+
+skl_status shm_ring_channel_t::create(const char* f_name, const layout_t& f_layout, EShmRingRole f_role, bool f_use_huge_pages) noexcept {
+    if (is_attached()) {
+        return SKL_ERR_STATE;
+    }
+
+    const u64 offset = objects_offset(f_layout);
+    const u64 size   = offset + (f_layout.m_object_size * f_layout.m_slots_count);
+
+    auto result = m_segment.create(f_name, size, f_use_huge_pages);
+    if (SKL_ERR_EXISTING == result) {
+        // Replace the segment if it was left behind by dead processes
+        bool is_stale = false;
+        if (m_segment.open(f_name).is_success()) {
+            is_stale = (false == m_segment.is_locked_by_other(u32(EShmRingRole::Producer))) && (false == m_segment.is_locked_by_other(u32(EShmRingRole::Consumer)));
+            m_segment.close();
+        }
+
+        if (false == is_stale) {
+            return SKL_ERR_EXISTING;
+        }
+
+        SWARNING_LOCAL("shm_ring_channel_t::create({}) Replacing the stale segment!", f_name);
+        shm_segment_t::unlink(f_name);
+        result = m_segment.create(f_name, size, f_use_huge_pages);
+    }
+
+    if (result.is_failure()) {
+        return result;
+    }
+
+    // Take the role first, the segment is not seen as stale while it is being initialized
+    auto* header             = new (m_segment.data()) shm_ring_header_t{};
+    header->m_magic          = CShmRingMagic;
+    header->m_version        = CShmRingVersion;
+    header->m_objects_offset = offset;
+    m_header                 = header;
+    result                   = take_role(f_role);
+    if (result.is_failure()) {
+        detach();
+        return result;
+    }
+
+    header->m_kind        = u32(f_layout.m_kind);
+    header->m_object_size = f_layout.m_object_size;
+    header->m_slots_count = f_layout.m_slots_count;
+    header->m_ready.store_release(CShmRingReady);
+
+    return SKL_SUCCESS;
+}
+
+skl_status shm_ring_channel_t::attach(const char* f_name, const layout_t& f_layout, EShmRingRole f_role) noexcept {
+    if (is_attached()) {
+        return SKL_ERR_STATE;
+    }
+
+    auto result = m_segment.open(f_name);
+    if (result.is_failure()) {
+        return result;
+    }
+
+    if (m_segment.size() < sizeof(shm_ring_header_t)) {
+        m_segment.close();
+        return SKL_ERR_CORRUPT;
+    }
+
+    // Identity first, a foreign segment is corrupt (a zero filled header is a segment still being created)
+    auto*      header   = reinterpret_cast<shm_ring_header_t*>(m_segment.data());
+    const bool is_ready = CShmRingReady == header->m_ready.load_acquire();
+    if ((false == is_ready) && (0ULL == header->m_magic)) {
+        m_segment.close();
+        return SKL_ERR_STATE;
+    }
+
+    if ((CShmRingMagic != header->m_magic) || (CShmRingVersion != header->m_version)) {
+        SERROR_LOCAL("shm_ring_channel_t::attach({}) Invalid header (magic {} version {} expected {})!", f_name, header->m_magic, header->m_version, CShmRingVersion);
+        m_segment.close();
+        return SKL_ERR_CORRUPT;
+    }
+
+    if (false == is_ready) {
+        m_segment.close();
+        return SKL_ERR_STATE;
+    }
+
+    const u64 offset = objects_offset(f_layout);
+    if ((u32(f_layout.m_kind) != header->m_kind)
+        || (f_layout.m_object_size != header->m_object_size)
+        || (f_layout.m_slots_count != header->m_slots_count)
+        || (offset != header->m_objects_offset)
+        || (m_segment.size() < (offset + (f_layout.m_object_size * f_layout.m_slots_count)))) {
+        SERROR_LOCAL("shm_ring_channel_t::attach({}) Layout mismatch (kind {} expected {}, object size {} expected {}, slots {} expected {})!",
+                     f_name,
+                     header->m_kind,
+                     u32(f_layout.m_kind),
+                     header->m_object_size,
+                     f_layout.m_object_size,
+                     header->m_slots_count,
+                     f_layout.m_slots_count);
+        m_segment.close();
+        return SKL_ERR_SIZE;
+    }
+
+    m_header = header;
+    result   = take_role(f_role);
+    if (result.is_failure()) {
+        detach();
+    }
+
+    return result;
+}
+
+skl_status shm_ring_channel_t::take_role(EShmRingRole f_role) noexcept {
+    if (false == m_segment.try_lock(u32(f_role))) {
+        return SKL_ERR_DUPLICATE;
+    }
+
+    m_role    = f_role;
+    m_objects = m_segment.data() + m_header->m_objects_offset;
+    return SKL_SUCCESS;
+}
+
+void shm_ring_channel_t::detach() noexcept {
+    m_segment.close();
+    m_header  = nullptr;
+    m_objects = nullptr;
+}
+
+bool shm_ring_channel_t::is_peer_alive() const noexcept {
+    return is_attached() && m_segment.is_locked_by_other(shm_ring_peer_role_index(m_role));
+}
+} // namespace skl
@@ -0,0 +1,72 @@
+//!
+//! \file skl_simd
+//!
+//! \brief SIMD kernels runtime dispatch
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include "skl_simd"
+
+namespace {
+using find_first_not_equal_u64_t = u32 (*)(const u64*, u32, u64) noexcept;
+
+[[nodiscard]] skl::simd::ESimdLevel detect_cpu_simd_level() noexcept {
+#if defined(__x86_64__)
+    // Needed if called before the libgcc/compiler-rt cpu model constructor ran
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f")) {
+        return skl::simd::ESimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return skl::simd::ESimdLevel::AVX2;
+    }
+    return skl::simd::ESimdLevel::SSE2;
+#else
+    return skl::simd::ESimdLevel::Scalar;
+#endif
+}
+
+[[nodiscard]] find_first_not_equal_u64_t select_find_first_not_equal_u64(skl::simd::ESimdLevel f_level) noexcept {
+#if defined(__x86_64__)
+    switch (f_level) {
+        case skl::simd::ESimdLevel::AVX512:
+            return &skl::simd::detail::find_first_not_equal_u64_avx512;
+        case skl::simd::ESimdLevel::AVX2:
+            return &skl::simd::detail::find_first_not_equal_u64_avx2;
+        case skl::simd::ESimdLevel::SSE2:
+            return &skl::simd::detail::find_first_not_equal_u64_sse2;
+        case skl::simd::ESimdLevel::Scalar:
+            break;
+    }
+#else
+    (void)f_level;
+#endif
+    return [](const u64* f_words, u32 f_count, u64 f_value) noexcept {
+        return skl::simd::detail::find_first_not_equal_u64_scalar(f_words, f_count, f_value);
+    };
+}
+} // namespace
+
+namespace skl::simd {
+ESimdLevel cpu_simd_level() noexcept {
+    // Detected on first use, safe to call during static initialization
+    static const ESimdLevel level = detect_cpu_simd_level();
+    return level;
+}
+
+ESimdLevel active_simd_level() noexcept {
+#if SKL_SIMD_RUNTIME_DISPATCH
+    return cpu_simd_level();
+#else
+    return CCompiledSimdLevel;
+#endif
+}
+
+namespace detail {
+    u32 find_first_not_equal_u64_dispatch(const u64* f_words, u32 f_count, u64 f_value) noexcept {
+        static const find_first_not_equal_u64_t kernel = select_find_first_not_equal_u64(cpu_simd_level());
+        return kernel(f_words, f_count, f_value);
+    }
+} // namespace detail
+} // namespace skl::simd
@@ -8,6 +8,7 @@
 #include <chrono>
 #include <ctime>
 
+#include <sched.h>
 #include <unistd.h>
 
 #include "skl_assert"
@@ -68,4 +69,8 @@ void skl_busy_sleep(u32 f_ms) noexcept {
         __builtin_ia32_pause();
     }
 }
+
+void skl_yield() noexcept {
+    (void)sched_yield();
+}
 } // namespace skl
@@ -0,0 +1,496 @@
+//!
+//! \file skl_slogger_async
+//!
+//! \brief serialized logger async back-end (per producer spsc rings drained by a dedicated thread)
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <new>
+
+#include "skl_sleep"
+#include "skl_thread"
+#include "skl_stream"
+#include "skl_spin_lock"
+#include "skl_spsc_unidirectional_ring"
+#include "skl_traits/size"
+#include "skl_logger/skl_slogger_sink.hpp"
+
+namespace skl {
+void* skl_core_alloc(u64 f_bytes_count, u64 f_alignment) noexcept;
+void  skl_core_free(void* f_block) noexcept;
+void  slogger_set_async_enabled(bool f_enabled) noexcept;
+} // namespace skl
+
+namespace {
+//! Record header, written at the start of the first chunk of each record
+struct slogger_async_record_header_t {
+    skl::SLoggerSink* m_sink;         //!< Sink to hand the record to
+    u32               m_length;       //!< Serialized record length
+    u32               m_chunks_count; //!< Count of chunks the record spans (header included)
+};
+
+//! Ring unit, records span multiple consecutive chunks
+struct slogger_async_chunk_t {
+    byte m_data[skl::CSLoggerAsyncChunkSize];
+};
+
+constexpr u64 CSLoggerAsyncRecordHeaderSize   = sizeof(slogger_async_record_header_t);
+constexpr u32 CSLoggerAsyncMaxChunksPerRecord = u32(skl::integral_ceil(CSLoggerAsyncRecordHeaderSize + skl::CSerializedLoggerThreadBufferSize, skl::CSLoggerAsyncChunkSize));
+constexpr u32 CSLoggerAsyncDrainBurst         = 256U;
+constexpr u32 CSLoggerAsyncMaxBackendSinks    = 16U;
+
+static_assert((skl::CSLoggerAsyncChunkSize > CSLoggerAsyncRecordHeaderSize) && (0U == (skl::CSLoggerAsyncChunkSize & (skl::CSLoggerAsyncChunkSize - 1U))),
+              "SKL::CSLoggerAsyncChunkSize must be a power of 2 and larger than the record header!");
+static_assert(skl::CSLoggerAsyncRingSize >= (CSLoggerAsyncMaxChunksPerRecord * 2U), "SKL::CSLoggerAsyncRingSize must fit at least 2 max sized records!");
+
+//! Per producer thread async state
+struct slogger_async_producer_t {
+    using ring_t = skl::spsc_unidirectional_ring_t<slogger_async_chunk_t, skl::CSLoggerAsyncRingSize, false>;
+
+    ring_t m_ring; //!< {Producer -> Back-end} Serialized records
+
+    SKL_CACHE_ALIGNED std::relaxed_value<u64> m_submitted_count = 0U; //!< {Producer} Records submitted
+    std::relaxed_value<u64>                   m_submitted_bytes = 0U; //!< {Producer} Bytes submitted
+    std::relaxed_value<u64>                   m_dropped_count   = 0U; //!< {Producer} Records dropped [Drop]
+    std::relaxed_value<u64>                   m_blocked_count   = 0U; //!< {Producer} Records that waited for space [Block]
+    std::relaxed_value<bool>                  m_detached        = false; //!< {Producer} The owning thread ended, free once drained
+    std::relaxed_value<bool>                  m_submitting      = false; //!< {Producer} Inside slogger_async_submit() (see slogger_async_wait_in_flight_submits())
+
+    SKL_CACHE_ALIGNED std::relaxed_value<u64> m_processed_count = 0U; //!< {Back-end} Records sunk
+};
+
+//! Async back-end state
+enum class ESLoggerAsyncState : u8 {
+    Stopped,
+    Running,
+    Stopping
+};
+
+//! Back-end thread drain context
+struct slogger_async_drain_ctx_t {
+    skl::SLoggerSink* m_initialized_sinks[CSLoggerAsyncMaxBackendSinks]{}; //!< Sinks initialized on the draining thread
+    u32               m_initialized_sinks_count = 0U;                      //!< Count of sinks initialized on the draining thread
+    byte              m_record_buffer[skl::CSerializedLoggerThreadBufferSize + 1U];
+};
+
+//! All producers, slots in [0, g_slogger_async_producers_end) can be non-null
+SKL_CACHE_ALIGNED std::relaxed_value<slogger_async_producer_t*> g_slogger_async_producers[skl::CSLoggerAsyncMaxProducers];
+SKL_CACHE_ALIGNED std::relaxed_value<u32> g_slogger_async_producers_end = 0U;
+
+//! Guards producers (un)registration and the back-end state transitions
+skl::spin_lock_t g_slogger_async_lock;
+
+//! Counters of freed producers
+skl::slogger_async_stats_t g_slogger_async_retired_stats;
+
+//! Back-end state (only changed under g_slogger_async_lock)
+ESLoggerAsyncState g_slogger_async_state = ESLoggerAsyncState::Stopped;
+
+//! Is the back-end thread draining (producers in [Block] use this to bail out)
+SKL_CACHE_ALIGNED std::relaxed_value<bool> g_slogger_async_running = false;
+
+//! Current config
+skl::slogger_async_config_t g_slogger_async_config;
+
+//! Back-end thread
+skl::SKLThread g_slogger_async_thread{skl::skl_string_view::exact_cstr("SKL SLogger Async")};
+
+//! Calling thread producer
+thread_local slogger_async_producer_t* g_slogger_async_thread_producer = nullptr;
+
+//! Is the calling thread draining the async rings
+thread_local bool g_slogger_async_is_backend_thread = false;
+
+//! [SingleWriter] Bump counter
+SKL_FORCEINLINE void slogger_async_bump(std::relaxed_value<u64>& f_counter, u64 f_value = 1U) noexcept {
+    f_counter.store_relaxed(f_counter.load_relaxed() + f_value);
+}
+
+void slogger_async_retire_producer(slogger_async_producer_t* f_producer) noexcept {
+    g_slogger_async_retired_stats.m_submitted_count += f_producer->m_submitted_count.load_relaxed();
+    g_slogger_async_retired_stats.m_submitted_bytes += f_producer->m_submitted_bytes.load_relaxed();
+    g_slogger_async_retired_stats.m_processed_count += f_producer->m_processed_count.load_relaxed();
+    g_slogger_async_retired_stats.m_dropped_count += f_producer->m_dropped_count.load_relaxed();
+    g_slogger_async_retired_stats.m_blocked_count += f_producer->m_blocked_count.load_relaxed();
+
+    f_producer->~slogger_async_producer_t();
+    skl::skl_core_free(f_producer);
+}
+
+SKL_NOINLINE slogger_async_producer_t* slogger_async_register_producer() noexcept {
+    auto* memory = skl::skl_core_alloc(sizeof(slogger_async_producer_t), alignof(slogger_async_producer_t));
+    if (nullptr == memory) {
+        return nullptr;
+    }
+
+    auto* producer = new (memory) slogger_async_producer_t();
+
+    skl::lock_guard_t guard{g_slogger_async_lock};
+
+    //Reuse a free slot first
+    const u32 end = g_slogger_async_producers_end.load_relaxed();
+    for (u32 i = 0U; i < end; ++i) {
+        if (nullptr == g_slogger_async_producers[i].load_relaxed()) {
+            g_slogger_async_producers[i].store_release(producer);
+            return producer;
+        }
+    }
+
+    if (end >= skl::CSLoggerAsyncMaxProducers) {
+        (void)puts("[SLogger] Async logger max producers count reached! Logging synchronously on this thread!");
+        producer->~slogger_async_producer_t();
+        skl::skl_core_free(producer);
+        return nullptr;
+    }
+
+    g_slogger_async_producers[end].store_release(producer);
+    g_slogger_async_producers_end.store_release(end + 1U);
+
+    return producer;
+}
+
+//! Sink the record dequeued as \p f_chunks
+void slogger_async_sink_record(slogger_async_drain_ctx_t& f_ctx, slogger_async_chunk_t** f_chunks) noexcept {
+    const auto& header = *reinterpret_cast<const slogger_async_record_header_t*>(f_chunks[0U]->m_data);
+    auto*       sink   = header.m_sink;
+
+    //Lazy init the sink on the draining thread
+    bool is_initialized = false;
+    for (u32 i = 0U; i < f_ctx.m_initialized_sinks_count; ++i) {
+        if (f_ctx.m_initialized_sinks[i] == sink) {
+            is_initialized = true;
+            break;
+        }
+    }
+    if (false == is_initialized) [[unlikely]] {
+        SKL_ASSERT_PERMANENT(f_ctx.m_initialized_sinks_count < CSLoggerAsyncMaxBackendSinks);
+        sink->thread_init();
+        f_ctx.m_initialized_sinks[f_ctx.m_initialized_sinks_count++] = sink;
+    }
+
+    //Records that do not wrap around the ring are sunk in place
+    byte* record = nullptr;
+    if ((f_chunks[0U] + (header.m_chunks_count - 1U)) == f_chunks[header.m_chunks_count - 1U]) {
+        [[likely]] record = f_chunks[0U]->m_data + CSLoggerAsyncRecordHeaderSize;
+    } else {
+        constexpr u64 CFirstChunkPayload = skl::CSLoggerAsyncChunkSize - CSLoggerAsyncRecordHeaderSize;
+
+        u64 remaining = header.m_length;
+        u64 size      = (remaining < CFirstChunkPayload) ? remaining : CFirstChunkPayload;
+        __builtin_memcpy(f_ctx.m_record_buffer, f_chunks[0U]->m_data + CSLoggerAsyncRecordHeaderSize, size);
+        remaining -= size;
+
+        for (u32 i = 1U; i < header.m_chunks_count; ++i) {
+            size = (remaining < skl::CSLoggerAsyncChunkSize) ? remaining : skl::CSLoggerAsyncChunkSize;
+            __builtin_memcpy(f_ctx.m_record_buffer + (header.m_length - remaining), f_chunks[i]->m_data, size);
+            remaining -= size;
+        }
+
+        record = f_ctx.m_record_buffer;
+    }
+
+    //Sinks are given the stream right after serialization (position = length)
+    skl::skl_buffer_view view{header.m_length, header.m_length, record};
+    sink->end_and_sink_log(skl::skl_stream::make(view));
+}
+
+//! Drain up to CSLoggerAsyncDrainBurst records from \p f_producer
+u32 slogger_async_drain_producer(slogger_async_drain_ctx_t& f_ctx, slogger_async_producer_t& f_producer) noexcept {
+    slogger_async_chunk_t* chunks[CSLoggerAsyncMaxChunksPerRecord];
+    auto&                  ring = f_producer.m_ring;
+
+    u32 records_count = 0U;
+    while (records_count < CSLoggerAsyncDrainBurst) {
+        if (0U == ring.dequeue_burst(chunks, 1U)) {
+            break;
+        }
+
+        //All chunks of a record are submitted at once
+        const u32 chunks_count = reinterpret_cast<const slogger_async_record_header_t*>(chunks[0U]->m_data)->m_chunks_count;
+        SKL_ASSERT_CRITICAL((0U < chunks_count) && (chunks_count <= CSLoggerAsyncMaxChunksPerRecord));
+        if (1U < chunks_count) {
+            const u32 dequeued = ring.dequeue_burst(chunks + 1U, chunks_count - 1U);
+            SKL_ASSERT_PERMANENT(dequeued == (chunks_count - 1U));
+        }
+
+        slogger_async_sink_record(f_ctx, chunks);
+        ++records_count;
+    }
+
+    if (0U < records_count) {
+        ring.free_processed();
+        slogger_async_bump(f_producer.m_processed_count, records_count);
+    }
+
+    return records_count;
+}
+
+//! Drain all producers once, free the drained detached producers
+u32 slogger_async_drain_all(slogger_async_drain_ctx_t& f_ctx) noexcept {
+    u32 records_count = 0U;
+
+    const u32 end = g_slogger_async_producers_end.load_acquire();
+    for (u32 i = 0U; i < end; ++i) {
+        auto* producer = g_slogger_async_producers[i].load_acquire();
+        if (nullptr == producer) {
+            continue;
+        }
+
+        records_count += slogger_async_drain_producer(f_ctx, *producer);
+
+        if (producer->m_detached.load_acquire() && (0U == producer->m_ring.pending_count())) [[unlikely]] {
+            skl::lock_guard_t guard{g_slogger_async_lock};
+            g_slogger_async_producers[i].store_release(nullptr);
+            slogger_async_retire_producer(producer);
+        }
+    }
+
+    return records_count;
+}
+
+//! Wait for the producers that saw the back-end running to finish their submit
+//! \remark Called by the back-end thread after it observed g_slogger_async_running == false, the fence pairs with the one in slogger_async_submit()
+void slogger_async_wait_in_flight_submits() noexcept {
+    skl::atomic_thread_fence_seq_cst();
+
+    const u32 end = g_slogger_async_producers_end.load_acquire();
+    for (u32 i = 0U; i < end; ++i) {
+        const auto* producer = g_slogger_async_producers[i].load_acquire();
+        if (nullptr == producer) {
+            continue;
+        }
+
+        while (producer->m_submitting.load_acquire()) {
+            __builtin_ia32_pause();
+        }
+    }
+}
+
+i32 slogger_async_backend_thread_run() noexcept {
+    g_slogger_async_is_backend_thread = true;
+
+    auto* memory = skl::skl_core_alloc(sizeof(slogger_async_drain_ctx_t), alignof(slogger_async_drain_ctx_t));
+    SKL_ASSERT_PERMANENT(nullptr != memory);
+    auto* ctx = new (memory) slogger_async_drain_ctx_t();
+
+    const u32 idle_sleep_us = g_slogger_async_config.m_idle_sleep_us;
+
+    while (g_slogger_async_running.load_acquire()) {
+        if (0U == slogger_async_drain_all(*ctx)) {
+            skl::skl_usleep(idle_sleep_us);
+        }
+    }
+
+    //Final drain, until a full pass finds nothing (producers that still saw the back-end running have submitted by now)
+    slogger_async_wait_in_flight_submits();
+    while (0U < slogger_async_drain_all(*ctx)) { }
+
+    for (u32 i = 0U; i < ctx->m_initialized_sinks_count; ++i) {
+        ctx->m_initialized_sinks[i]->thread_deinit();
+    }
+
+    ctx->~slogger_async_drain_ctx_t();
+    skl::skl_core_free(ctx);
+
+    g_slogger_async_is_backend_thread = false;
+
+    return 0;
+}
+} // namespace
+
+namespace skl {
+bool slogger_async_submit(SLoggerSink& f_sink, skl_stream& f_log_stream) noexcept {
+    if (g_slogger_async_is_backend_thread) [[unlikely]] {
+        return false;
+    }
+
+    auto* producer = g_slogger_async_thread_producer;
+    if (nullptr == producer) [[unlikely]] {
+        producer = slogger_async_register_producer();
+        if (nullptr == producer) {
+            return false;
+        }
+        g_slogger_async_thread_producer = producer;
+    }
+
+    const u32 length       = f_log_stream.position();
+    const u32 chunks_count = u32(integral_ceil(CSLoggerAsyncRecordHeaderSize + length, CSLoggerAsyncChunkSize));
+    SKL_ASSERT(chunks_count <= CSLoggerAsyncMaxChunksPerRecord);
+
+    //Announce the submit before checking the back-end state, the back-end waits for it before its final drain (the fence pairs with the one in slogger_async_wait_in_flight_submits())
+    producer->m_submitting.store_relaxed(true);
+    atomic_thread_fence_seq_cst();
+    if (false == g_slogger_async_running.load_relaxed()) [[unlikely]] {
+        //The back-end is stopping (or stopped), sink on this thread
+        producer->m_submitting.store_release(false);
+        return false;
+    }
+
+    slogger_async_chunk_t* chunks[CSLoggerAsyncMaxChunksPerRecord];
+    auto&                  ring = producer->m_ring;
+    if (false == ring.allocate_bulk(chunks, chunks_count)) [[unlikely]] {
+        if (ESLoggerAsyncOverflowPolicy::Drop == g_slogger_async_config.m_overflow_policy) {
+            slogger_async_bump(producer->m_dropped_count);
+            producer->m_submitting.store_release(false);
+            return true;
+        }
+
+        slogger_async_bump(producer->m_blocked_count);
+        do {
+            if (false == g_slogger_async_running.load_acquire()) {
+                //The back-end is stopping, sink on this thread
+                producer->m_submitting.store_release(false);
+                return false;
+            }
+            __builtin_ia32_pause();
+        } while (false == ring.allocate_bulk(chunks, chunks_count));
+    }
+
+    //Header
+    auto& header          = *reinterpret_cast<slogger_async_record_header_t*>(chunks[0U]->m_data);
+    header.m_sink         = &f_sink;
+    header.m_length       = length;
+    header.m_chunks_count = chunks_count;
+
+    //Record
+    const byte* source = f_log_stream.buffer();
+    if ((chunks[0U] + (chunks_count - 1U)) == chunks[chunks_count - 1U]) {
+        [[likely]] __builtin_memcpy(chunks[0U]->m_data + CSLoggerAsyncRecordHeaderSize, source, length);
+    } else {
+        constexpr u64 CFirstChunkPayload = CSLoggerAsyncChunkSize - CSLoggerAsyncRecordHeaderSize;
+
+        u64 remaining = length;
+        u64 size      = (remaining < CFirstChunkPayload) ? remaining : CFirstChunkPayload;
+        __builtin_memcpy(chunks[0U]->m_data + CSLoggerAsyncRecordHeaderSize, source, size);
+        remaining -= size;
+
+        for (u32 i = 1U; i < chunks_count; ++i) {
+            size = (remaining < CSLoggerAsyncChunkSize) ? remaining : CSLoggerAsyncChunkSize;
+            __builtin_memcpy(chunks[i]->m_data, source + (length - remaining), size);
+            remaining -= size;
+        }
+    }
+
+    ring.submit();
+
+    slogger_async_bump(producer->m_submitted_count);
+    slogger_async_bump(producer->m_submitted_bytes, length);
+    producer->m_submitting.store_release(false);
+
+    return true;
+}
+
+void slogger_async_deinit_thread() noexcept {
+    auto* producer = g_slogger_async_thread_producer;
+    if (nullptr == producer) {
+        return;
+    }
+
+    g_slogger_async_thread_producer = nullptr;
+
+    skl::lock_guard_t guard{g_slogger_async_lock};
+    if (ESLoggerAsyncState::Stopped != g_slogger_async_state) {
+        //The back-end thread frees it once drained
+        producer->m_detached.store_release(true);
+        return;
+    }
+
+    //No back-end thread, the ring is already drained
+    const u32 end = g_slogger_async_producers_end.load_relaxed();
+    for (u32 i = 0U; i < end; ++i) {
+        if (producer == g_slogger_async_producers[i].load_relaxed()) {
+            g_slogger_async_producers[i].store_release(nullptr);
+            break;
+        }
+    }
+    slogger_async_retire_producer(producer);
+}
+
+skl_status SLoggerSinkManager::start_async(const slogger_async_config_t& f_config) noexcept {
+    {
+        lock_guard_t guard{g_slogger_async_lock};
+        if (ESLoggerAsyncState::Stopped != g_slogger_async_state) {
+            return SKL_OK_REDUNDANT;
+        }
+        g_slogger_async_state = ESLoggerAsyncState::Running;
+    }
+
+    g_slogger_async_config = f_config;
+    g_slogger_async_running.store_release(true);
+    g_slogger_async_thread.set_handler(&slogger_async_backend_thread_run);
+
+    const auto result = g_slogger_async_thread.create(f_config.m_cpu_affinity);
+    if (result.is_failure()) {
+        g_slogger_async_running.store_release(false);
+
+        lock_guard_t guard{g_slogger_async_lock};
+        g_slogger_async_state = ESLoggerAsyncState::Stopped;
+
+        return SKL_ERR_THREAD;
+    }
+
+    slogger_set_async_enabled(true);
+
+    return SKL_SUCCESS;
+}
+
+skl_status SLoggerSinkManager::stop_async() noexcept {
+    {
+        lock_guard_t guard{g_slogger_async_lock};
+        if (ESLoggerAsyncState::Running != g_slogger_async_state) {
+            return SKL_OK_REDUNDANT;
+        }
+        g_slogger_async_state = ESLoggerAsyncState::Stopping;
+    }
+
+    //New records are sunk on the producer threads from now on
+    slogger_set_async_enabled(false);
+
+    //Stop and join the back-end thread (it waits for the in flight submits and drains all rings before exiting)
+    g_slogger_async_running.store_release(false);
+    (void)g_slogger_async_thread.join();
+
+    lock_guard_t guard{g_slogger_async_lock};
+
+    //Free the detached producers, the rings are drained
+    const u32 end = g_slogger_async_producers_end.load_relaxed();
+    for (u32 i = 0U; i < end; ++i) {
+        auto* producer = g_slogger_async_producers[i].load_relaxed();
+        if ((nullptr != producer) && producer->m_detached.load_acquire()) {
+            g_slogger_async_producers[i].store_release(nullptr);
+            slogger_async_retire_producer(producer);
+        }
+    }
+
+    g_slogger_async_state = ESLoggerAsyncState::Stopped;
+
+    return SKL_SUCCESS;
+}
+
+bool SLoggerSinkManager::is_async() noexcept {
+    return g_slogger_async_running.load_acquire();
+}
+
+slogger_async_stats_t SLoggerSinkManager::get_async_stats() noexcept {
+    lock_guard_t guard{g_slogger_async_lock};
+
+    slogger_async_stats_t result = g_slogger_async_retired_stats;
+
+    const u32 end = g_slogger_async_producers_end.load_relaxed();
+    for (u32 i = 0U; i < end; ++i) {
+        const auto* producer = g_slogger_async_producers[i].load_relaxed();
+        if (nullptr == producer) {
+            continue;
+        }
+
+        result.m_submitted_count += producer->m_submitted_count.load_relaxed();
+        result.m_submitted_bytes += producer->m_submitted_bytes.load_relaxed();
+        result.m_processed_count += producer->m_processed_count.load_relaxed();
+        result.m_dropped_count += producer->m_dropped_count.load_relaxed();
+        result.m_blocked_count += producer->m_blocked_count.load_relaxed();
+        ++result.m_producers_count;
+    }
+
+    return result;
+}
+} // namespace skl
@@ -61,13 +61,28 @@ struct DeserializeResult {
 [[nodiscard]] DeserializeResult deserilalize_log(skl::skl_stream& f_stream) noexcept {
     DeserializeResult result{};
 
-    result.m_timestamp   = f_stream.read<u32>();
-    result.m_uid         = f_stream.read<u16>();
-    result.m_type        = static_cast<skl::ELogType>(f_stream.read<u8>());
-    result.m_line_number = f_stream.read<u16>();
-    result.m_file_name   = f_stream.read_length_prefixed_str_checked();
-    result.m_fmt_string  = f_stream.read_length_prefixed_str_checked();
-    result.m_args_count  = f_stream.read<u16>();
+    result.m_timestamp = f_stream.read<u32>();
+    result.m_uid       = f_stream.read<u16>();
+
+    const u8 type = f_stream.read<u8>();
+    result.m_type = static_cast<skl::ELogType>(type & ~skl::CSLoggerSiteRecordFlag);
+
+    if (0U != (type & skl::CSLoggerSiteRecordFlag)) [[likely]] {
+        //Registered call site, the record carries only the site id
+        const auto* site = skl::skl_get_log_site(f_stream.read<skl::slogger_site_id_t>());
+        SKL_ASSERT(nullptr != site);
+        if (nullptr != site) [[likely]] {
+            result.m_line_number = site->m_line_number;
+            result.m_file_name   = site->m_file_name;
+            result.m_fmt_string  = site->m_fmt_string;
+        }
+    } else {
+        result.m_line_number = f_stream.read<u16>();
+        result.m_file_name   = f_stream.read_length_prefixed_str_checked();
+        result.m_fmt_string  = f_stream.read_length_prefixed_str_checked();
+    }
+
+    result.m_args_count = f_stream.read<u16>();
 
     //Until here we rely on the min check of the log buffer size to guarantee that we had space,
     //from now on we need to validate the read calls (99.9999% reads will be ok <-> very well predicted branches and will fit in buffer)
@@ -334,6 +349,87 @@ skl_string_view SKLSerializedLoggerBackend::process(skl_stream& f_stream) noexce
 skl_string_view SKLSerializedLoggerBackend::process_no_colors(skl_stream& f_stream) noexcept {
     return slogger_backend_process<false>(f_stream);
 }
+
+//! Check that the fixed part of the raw record (header, file name and fmt string) is within \p f_length
+//! \remark Records carrying a site id are rejected, the site ids are valid only in the producing process
+bool slogger_is_raw_record_valid(const byte* f_record, u32 f_length) noexcept {
+    constexpr u32 CPrefixSize = u32(sizeof(skl_stream::str_len_prefix_t));
+    constexpr u32 CMinSize    = u32(CSerializedLoggerFixedHeaderSize) + (CPrefixSize * 2U);
+
+    if ((f_length < CMinSize) || (f_length > CSerializedLoggerThreadBufferSize)) {
+        return false;
+    }
+
+    if (0U != (f_record[4U + 2U] & CSLoggerSiteRecordFlag)) {
+        return false;
+    }
+
+    //[u32 timestamp][u16 uid][u8 type][u16 line][file name][fmt string][u16 args count]
+    u32 offset = 4U + 2U + 1U + 2U;
+    for (u32 i = 0U; i < 2U; ++i) {
+        if ((offset + CPrefixSize) > f_length) {
+            return false;
+        }
+        skl_stream::str_len_prefix_t str_length;
+        __builtin_memcpy(&str_length, f_record + offset, CPrefixSize);
+        offset += CPrefixSize;
+        if (str_length > (f_length - offset)) {
+            return false;
+        }
+        offset += str_length;
+    }
+
+    return (offset + 2U) <= f_length;
+}
+
+//! Expand the raw record into \p f_out, a site id is replaced by the line number, file name and fmt string (records leaving the process)
+//! \returns the expanded record length, 0 if the site is unknown or the expanded record does not fit in \p f_capacity
+u32 slogger_expand_raw_record(const byte* f_record, u32 f_length, byte* f_out, u32 f_capacity) noexcept {
+    constexpr u32 CPrefixSize     = u32(sizeof(skl_stream::str_len_prefix_t));
+    constexpr u32 CTypeOffset     = 4U + 2U;
+    constexpr u32 CSiteRestOffset = CTypeOffset + 1U + u32(sizeof(slogger_site_id_t));
+
+    if (0U == (f_record[CTypeOffset] & CSLoggerSiteRecordFlag)) {
+        if (f_length > f_capacity) [[unlikely]] {
+            return 0U;
+        }
+        __builtin_memcpy(f_out, f_record, f_length);
+        return f_length;
+    }
+
+    SKL_ASSERT(CSiteRestOffset <= f_length);
+
+    slogger_site_id_t site_id;
+    __builtin_memcpy(&site_id, f_record + CTypeOffset + 1U, sizeof(site_id));
+    const auto* site = skl_get_log_site(site_id);
+    if (nullptr == site) [[unlikely]] {
+        return 0U;
+    }
+
+    const u32 file_length = u32(site->m_file_name.length());
+    const u32 fmt_length  = u32(site->m_fmt_string.length());
+    const u32 rest_length = f_length - CSiteRestOffset;
+    const u32 length      = CTypeOffset + 1U + 2U + (CPrefixSize * 2U) + file_length + fmt_length + rest_length;
+    if (length > f_capacity) [[unlikely]] {
+        return 0U;
+    }
+
+    //[u32 timestamp][u16 uid][u8 type][u16 line][u32 len][file name][u32 len][fmt string][u16 args count][args]
+    __builtin_memcpy(f_out, f_record, CTypeOffset);
+    f_out[CTypeOffset] = byte(f_record[CTypeOffset] & ~CSLoggerSiteRecordFlag);
+    byte* front        = f_out + CTypeOffset + 1U;
+    __builtin_memcpy(front, &site->m_line_number, 2U);
+    front += 2U;
+    __builtin_memcpy(front, &file_length, CPrefixSize);
+    __builtin_memcpy(front + CPrefixSize, site->m_file_name.data(), file_length);
+    front += CPrefixSize + file_length;
+    __builtin_memcpy(front, &fmt_length, CPrefixSize);
+    __builtin_memcpy(front + CPrefixSize, site->m_fmt_string.data(), fmt_length);
+    front += CPrefixSize + fmt_length;
+    __builtin_memcpy(front, f_record + CSiteRestOffset, rest_length);
+
+    return length;
+}
 } // namespace skl
 
 namespace skl {
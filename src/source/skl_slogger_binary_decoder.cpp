@@ -0,0 +1,263 @@
+//!
+//! \file skl_slogger_binary_decoder
+//!
+//! \brief serialized logger binary log file decoder (replays the records through the back-end)
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "skl_stream"
+#include "skl_logger/skl_slogger_fend.hpp"
+#include "skl_logger/skl_slogger_bend.hpp"
+#include "skl_logger/skl_slogger_binary.hpp"
+
+namespace skl {
+bool slogger_is_raw_record_valid(const byte* f_record, u32 f_length) noexcept;
+} // namespace skl
+
+namespace {
+//! Interned string location in the mapped file
+struct slogger_binary_dict_entry_t {
+    u64 m_offset;
+    u32 m_length;
+};
+
+constexpr u64 CSLoggerBinaryDecodeBufferSize    = skl::CSerializedLoggerThreadBufferSize + 1U;
+constexpr u64 CSLoggerBinaryDictionaryTableSize = sizeof(slogger_binary_dict_entry_t) * skl::CSLoggerBinaryDictionaryMaxEntries;
+constexpr u64 CSLoggerBinaryDecoderMemorySize   = CSLoggerBinaryDictionaryTableSize + CSLoggerBinaryDecodeBufferSize;
+
+//! Bounds checked reader over the mapped file
+struct slogger_binary_reader_t {
+    const byte* m_data;
+    u64         m_size;
+    u64         m_offset;
+
+    [[nodiscard]] bool has(u64 f_bytes) const noexcept {
+        return f_bytes <= (m_size - m_offset);
+    }
+
+    template <typename _T>
+    [[nodiscard]] _T read() noexcept {
+        _T value;
+        __builtin_memcpy(&value, m_data + m_offset, sizeof(_T));
+        m_offset += sizeof(_T);
+        return value;
+    }
+};
+} // namespace
+
+namespace skl {
+SLoggerBinaryDecoder::~SLoggerBinaryDecoder() noexcept {
+    close();
+}
+
+skl_status SLoggerBinaryDecoder::open(const char* f_file_path) noexcept {
+    if (is_open()) {
+        return SKL_ERR_STATE;
+    }
+
+    if (nullptr == f_file_path) {
+        return SKL_ERR_PARAMS;
+    }
+
+    const i32 fd = ::open(f_file_path, O_RDONLY | O_CLOEXEC);
+    if (-1 == fd) {
+        return SKL_ERR_FILE;
+    }
+
+    struct stat file_stat{};
+    if ((0 != ::fstat(fd, &file_stat)) || (0 >= file_stat.st_size)) {
+        (void)::close(fd);
+        return SKL_ERR_FILE;
+    }
+
+    void* file = ::mmap(nullptr, u64(file_stat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    (void)::close(fd);
+    if (MAP_FAILED == file) {
+        return SKL_ERR_FILE;
+    }
+
+    m_file      = reinterpret_cast<const byte*>(file);
+    m_file_size = u64(file_stat.st_size);
+
+    if (byte(ESLoggerBinaryEntry::Segment) != m_file[0]) {
+        close();
+        return SKL_ERR_CORRUPT;
+    }
+
+    void* memory = ::mmap(nullptr, CSLoggerBinaryDecoderMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == memory) {
+        close();
+        return SKL_ERR_ALLOC;
+    }
+    m_buffers = reinterpret_cast<byte*>(memory);
+    m_stats   = {};
+
+    return SKL_SUCCESS;
+}
+
+void SLoggerBinaryDecoder::close() noexcept {
+    if (nullptr != m_file) {
+        (void)::munmap(const_cast<byte*>(m_file), m_file_size);
+        m_file      = nullptr;
+        m_file_size = 0U;
+    }
+
+    if (nullptr != m_buffers) {
+        (void)::munmap(m_buffers, CSLoggerBinaryDecoderMemorySize);
+        m_buffers = nullptr;
+    }
+}
+
+skl_result<u64> SLoggerBinaryDecoder::decode_internal(bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept {
+    if (false == is_open()) {
+        return skl_fail{SKL_ERR_STATE};
+    }
+
+    auto* dictionary    = reinterpret_cast<slogger_binary_dict_entry_t*>(m_buffers);
+    byte* decode_buffer = m_buffers + CSLoggerBinaryDictionaryTableSize;
+
+    slogger_binary_reader_t reader{m_file, m_file_size, 0U};
+    u32                     dictionary_count = 0U;
+    bool                    has_segment      = false;
+    u64                     records          = 0U;
+
+    while (reader.has(1U)) {
+        const auto kind = ESLoggerBinaryEntry(reader.read<u8>());
+        switch (kind) {
+            case ESLoggerBinaryEntry::Segment:
+                {
+                    if (false == reader.has(sizeof(slogger_binary_segment_header_t))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const auto header = reader.read<slogger_binary_segment_header_t>();
+                    if ((CSLoggerBinaryMagic != header.m_magic) || (CSLoggerBinaryVersion != header.m_version)) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    //New segment, new dictionary
+                    dictionary_count = 0U;
+                    has_segment      = true;
+                    ++m_stats.m_segments_count;
+                }
+                break;
+            case ESLoggerBinaryEntry::Dictionary:
+                {
+                    if ((false == has_segment) || (false == reader.has(8U))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const u32 id     = reader.read<u32>();
+                    const u32 length = reader.read<u32>();
+                    if ((id != dictionary_count) || (CSLoggerBinaryDictionaryMaxEntries == dictionary_count) || (false == reader.has(length))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    dictionary[dictionary_count++] = {reader.m_offset, length};
+                    reader.m_offset += length;
+                    ++m_stats.m_dictionary_count;
+                }
+                break;
+            case ESLoggerBinaryEntry::Record:
+                {
+                    constexpr u32 CMinSize = CSLoggerBinaryRecordFixedSize + 4U + 4U + 2U;
+
+                    if ((false == has_segment) || (false == reader.has(2U))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const u16 size = reader.read<u16>();
+                    if ((size < CMinSize) || (false == reader.has(size))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const byte* entry = m_file + reader.m_offset;
+                    reader.m_offset += size;
+
+                    u32 file_id;
+                    u32 fmt_id;
+                    __builtin_memcpy(&file_id, entry + CSLoggerBinaryRecordFixedSize, sizeof(file_id));
+                    __builtin_memcpy(&fmt_id, entry + CSLoggerBinaryRecordFixedSize + 4U, sizeof(fmt_id));
+                    if ((file_id >= dictionary_count) || (fmt_id >= dictionary_count)) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const auto& file_name   = dictionary[file_id];
+                    const auto& fmt         = dictionary[fmt_id];
+                    const u32   rest_length = size - (CSLoggerBinaryRecordFixedSize + 8U);
+
+                    //Rebuild the raw serialized record: [fixed][u32 len][file name][u32 len][fmt string][u16 args count][args]
+                    const u64 length = u64(CSLoggerBinaryRecordFixedSize) + (sizeof(skl_stream::str_len_prefix_t) * 2U) + file_name.m_length + fmt.m_length + rest_length;
+                    if (length > CSerializedLoggerThreadBufferSize) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    byte* front = decode_buffer;
+                    __builtin_memcpy(front, entry, CSLoggerBinaryRecordFixedSize);
+                    front += CSLoggerBinaryRecordFixedSize;
+                    __builtin_memcpy(front, &file_name.m_length, sizeof(u32));
+                    __builtin_memcpy(front + sizeof(u32), m_file + file_name.m_offset, file_name.m_length);
+                    front += sizeof(u32) + file_name.m_length;
+                    __builtin_memcpy(front, &fmt.m_length, sizeof(u32));
+                    __builtin_memcpy(front + sizeof(u32), m_file + fmt.m_offset, fmt.m_length);
+                    front += sizeof(u32) + fmt.m_length;
+                    __builtin_memcpy(front, entry + CSLoggerBinaryRecordFixedSize + 8U, rest_length);
+                    decode_buffer[length] = 0U;
+
+                    skl_buffer_view view{length + 1U, decode_buffer};
+                    auto&           stream = skl_stream::make(view);
+                    f_handler(f_context, f_allow_colors ? SKLSerializedLoggerBackend::process(stream) : SKLSerializedLoggerBackend::process_no_colors(stream));
+
+                    ++m_stats.m_records_count;
+                    ++records;
+                }
+                break;
+            case ESLoggerBinaryEntry::RawRecord:
+                {
+                    if ((false == has_segment) || (false == reader.has(2U))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    const u16 size = reader.read<u16>();
+                    if ((false == reader.has(size)) || (false == slogger_is_raw_record_valid(m_file + reader.m_offset, size))) {
+                        ++m_stats.m_malformed_count;
+                        return skl_fail{SKL_ERR_CORRUPT};
+                    }
+
+                    __builtin_memcpy(decode_buffer, m_file + reader.m_offset, size);
+                    decode_buffer[size] = 0U;
+                    reader.m_offset += size;
+
+                    skl_buffer_view view{u64(size) + 1U, decode_buffer};
+                    auto&           stream = skl_stream::make(view);
+                    f_handler(f_context, f_allow_colors ? SKLSerializedLoggerBackend::process(stream) : SKLSerializedLoggerBackend::process_no_colors(stream));
+
+                    ++m_stats.m_records_count;
+                    ++records;
+                }
+                break;
+            default:
+                {
+                    ++m_stats.m_malformed_count;
+                    return skl_fail{SKL_ERR_CORRUPT};
+                }
+        }
+    }
+
+    return records;
+}
+} // namespace skl
@@ -8,6 +8,7 @@
 #include "skl_epoch"
 #include "skl_tls"
 #include "skl_atomic"
+#include "skl_spin_lock"
 #include "skl_logger/skl_slogger_fend.hpp"
 #include "skl_logger/skl_slogger_sink.hpp"
 
@@ -23,6 +24,11 @@ namespace {
     }();
     return thread_local_id;
 }
+
+//! Log call sites registry, append only (site id = index + 1)
+skl::slogger_site_t     g_slogger_sites[skl::CSLoggerMaxLogSites];
+std::relaxed_value<u32> g_slogger_sites_count{0U};
+skl::spin_lock_t        g_slogger_sites_lock;
 } // namespace
 
 struct SLoggerThreadFrontEnd {
@@ -89,6 +95,37 @@ void skl_commit_log(slogger_sink_id_t f_specific_sink_id) noexcept {
     slogger_sink_log(f_specific_sink_id);
 }
 
+slogger_site_id_t skl_register_log_site(std::relaxed_value<slogger_site_id_t>& f_slot, u16 f_line_number, skl_string_view f_file_name, skl_string_view f_fmt_string) noexcept {
+    lock_guard_t guard{g_slogger_sites_lock};
+
+    //Registered by another thread in the meantime
+    auto site_id = f_slot.load_relaxed();
+    if (CSLoggerNoSiteId != site_id) {
+        return site_id;
+    }
+
+    const u32 count = g_slogger_sites_count.load_relaxed();
+    if (CSLoggerMaxLogSites == count) [[unlikely]] {
+        site_id = CSLoggerInlineSiteId;
+    } else {
+        g_slogger_sites[count] = {f_file_name, f_fmt_string, f_line_number};
+        g_slogger_sites_count.store_release(count + 1U);
+        site_id = count + 1U;
+    }
+
+    //Publish the site to the logging threads (the records carrying the id are published to the back-end after this)
+    f_slot.store_release(site_id);
+
+    return site_id;
+}
+
+const slogger_site_t* skl_get_log_site(slogger_site_id_t f_site_id) noexcept {
+    if ((CSLoggerNoSiteId == f_site_id) || (f_site_id > g_slogger_sites_count.load_acquire())) [[unlikely]] {
+        return nullptr;
+    }
+    return &g_slogger_sites[f_site_id - 1U];
+}
+
 SKL_NOINLINE void skl_core_init_logger_on_thread() noexcept {
     SKL_ASSERT_PERMANENT(SLoggerFendTLS::tls_create().is_success());
     SKL_ASSERT_PERMANENT(SLoggerSinkManager::init_thread().is_success());
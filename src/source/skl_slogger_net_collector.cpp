@@ -0,0 +1,197 @@
+//!
+//! \file skl_slogger_net_collector
+//!
+//! \brief serialized logger network sink collector (receives the raw records and formats them)
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <cerrno>
+#include <poll.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#include "skl_stream"
+#include "skl_logger/skl_slogger_net.hpp"
+#include "skl_logger/skl_slogger_fend.hpp"
+#include "skl_logger/skl_slogger_bend.hpp"
+
+namespace skl {
+bool slogger_is_raw_record_valid(const byte* f_record, u32 f_length) noexcept;
+} // namespace skl
+
+namespace {
+constexpr u64 CSLoggerNetCollectorDecodeSize = skl::CSerializedLoggerThreadBufferSize + 1U;
+constexpr u64 CSLoggerNetCollectorMemorySize = (skl::CSLoggerNetMaxDatagramCapacity * skl::SLoggerNetCollector::CReceiveBatch) + CSLoggerNetCollectorDecodeSize;
+} // namespace
+
+namespace skl {
+SLoggerNetCollector::~SLoggerNetCollector() noexcept {
+    close();
+}
+
+skl_status SLoggerNetCollector::open(ipv4_addr_t f_address, net_port_t f_port) noexcept {
+    if (is_open()) {
+        return SKL_ERR_STATE;
+    }
+
+    void* memory = ::mmap(nullptr, CSLoggerNetCollectorMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (MAP_FAILED == memory) {
+        return SKL_ERR_ALLOC;
+    }
+    m_buffers = reinterpret_cast<byte*>(memory);
+
+    m_socket = alloc_ipv4_udp_socket();
+    if (false == is_socket_valid(m_socket)) {
+        close();
+        return SKL_ERR_PORT;
+    }
+
+    if (false == bind_socket(m_socket, f_address, f_port)) {
+        close();
+        return SKL_ERR_PORT;
+    }
+
+    //Get the bound port (f_port may be 0)
+    sockaddr_in bound{};
+    socklen_t   bound_length = sizeof(bound);
+    if (0 != ::getsockname(m_socket, reinterpret_cast<sockaddr*>(&bound), &bound_length)) {
+        close();
+        return SKL_ERR_PORT;
+    }
+
+    m_port          = be_to_le_u16(bound.sin_port);
+    m_has_sequence  = false;
+    m_next_sequence = 0U;
+    m_stats         = {};
+
+    return SKL_SUCCESS;
+}
+
+void SLoggerNetCollector::close() noexcept {
+    if (is_socket_valid(m_socket)) {
+        (void)close_socket(m_socket);
+        m_socket = CInvalidSocket;
+    }
+
+    if (nullptr != m_buffers) {
+        (void)::munmap(m_buffers, CSLoggerNetCollectorMemorySize);
+        m_buffers = nullptr;
+    }
+
+    m_port = 0U;
+}
+
+skl_result<u32> SLoggerNetCollector::poll_internal(u32 f_timeout_ms, bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept {
+    if (false == is_open()) {
+        return skl_fail{SKL_ERR_STATE};
+    }
+
+    pollfd poll_fd{};
+    poll_fd.fd     = m_socket;
+    poll_fd.events = POLLIN;
+
+    const i32 poll_result = ::poll(&poll_fd, 1U, i32(f_timeout_ms));
+    if (0 > poll_result) {
+        if (EINTR == errno) {
+            return 0U;
+        }
+        return skl_fail{SKL_ERR_RX};
+    }
+    if (0 == poll_result) {
+        return 0U;
+    }
+
+    iovec   iov[CReceiveBatch];
+    mmsghdr messages[CReceiveBatch];
+    for (u32 i = 0U; i < CReceiveBatch; ++i) {
+        iov[i].iov_base = m_buffers + (u64(i) * CSLoggerNetMaxDatagramCapacity);
+        iov[i].iov_len  = CSLoggerNetMaxDatagramCapacity;
+
+        __builtin_memset(&messages[i], 0, sizeof(mmsghdr));
+        messages[i].msg_hdr.msg_iov    = &iov[i];
+        messages[i].msg_hdr.msg_iovlen = 1U;
+    }
+
+    const i32 received = ::recvmmsg(m_socket, messages, CReceiveBatch, MSG_DONTWAIT, nullptr);
+    if (0 > received) {
+        if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno)) {
+            return 0U;
+        }
+        return skl_fail{SKL_ERR_RX};
+    }
+
+    u32 records = 0U;
+    for (u32 i = 0U; i < u32(received); ++i) {
+        ++m_stats.m_datagrams_count;
+        m_stats.m_bytes_count += messages[i].msg_len;
+
+        if (0U != (messages[i].msg_hdr.msg_flags & MSG_TRUNC)) [[unlikely]] {
+            ++m_stats.m_malformed_count;
+            continue;
+        }
+
+        records += decode_datagram(reinterpret_cast<byte*>(iov[i].iov_base), messages[i].msg_len, f_allow_colors, f_handler, f_context);
+    }
+
+    return records;
+}
+
+u32 SLoggerNetCollector::decode_datagram(byte* f_datagram, u32 f_size, bool f_allow_colors, record_handler_t f_handler, void* f_context) noexcept {
+    if (f_size < sizeof(slogger_net_datagram_header_t)) [[unlikely]] {
+        ++m_stats.m_malformed_count;
+        return 0U;
+    }
+
+    slogger_net_datagram_header_t header;
+    __builtin_memcpy(&header, f_datagram, sizeof(header));
+    if ((CSLoggerNetDatagramMagic != header.m_magic) || (CSLoggerNetProtocolVersion != header.m_version)) [[unlikely]] {
+        ++m_stats.m_malformed_count;
+        return 0U;
+    }
+
+    //Track lost datagrams (udp gives no delivery guarantee)
+    if (m_has_sequence && (header.m_sequence != m_next_sequence)) {
+        m_stats.m_lost_datagrams_count += u32(header.m_sequence - m_next_sequence);
+    }
+    m_has_sequence  = true;
+    m_next_sequence = header.m_sequence + 1U;
+
+    byte* decode_buffer = m_buffers + (u64(CReceiveBatch) * CSLoggerNetMaxDatagramCapacity);
+
+    u32 offset  = u32(sizeof(slogger_net_datagram_header_t));
+    u32 records = 0U;
+    for (u32 i = 0U; i < header.m_records_count; ++i) {
+        if ((offset + sizeof(slogger_net_record_len_t)) > f_size) [[unlikely]] {
+            ++m_stats.m_malformed_count;
+            break;
+        }
+
+        slogger_net_record_len_t length;
+        __builtin_memcpy(&length, f_datagram + offset, sizeof(length));
+        offset += u32(sizeof(slogger_net_record_len_t));
+
+        if ((length > (f_size - offset)) || (false == slogger_is_raw_record_valid(f_datagram + offset, length))) [[unlikely]] {
+            ++m_stats.m_malformed_count;
+            break;
+        }
+
+        //Decode from a terminated copy, the backend reads the typed args with bounds checks
+        __builtin_memcpy(decode_buffer, f_datagram + offset, length);
+        decode_buffer[length] = 0U;
+        offset += length;
+
+        skl_buffer_view view{u64(length) + 1U, decode_buffer};
+        auto&           stream = skl_stream::make(view);
+        const auto      text   = f_allow_colors ? SKLSerializedLoggerBackend::process(stream)
+                                                : SKLSerializedLoggerBackend::process_no_colors(stream);
+
+        f_handler(f_context, text);
+
+        ++m_stats.m_records_count;
+        ++records;
+    }
+
+    return records;
+}
+} // namespace skl
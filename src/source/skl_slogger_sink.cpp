@@ -27,6 +27,9 @@ SKL_CACHE_ALIGNED std::relaxed_value<skl::SLoggerSink*> g_skl_logger_sinks[i32(s
 //! Has performed default init
 std::relaxed_value<bool> g_skl_current_log_init_default = false;
 
+//! Is the async logger back-end running (commit copies the record into the thread's async ring)
+SKL_CACHE_ALIGNED std::relaxed_value<bool> g_skl_log_async_enabled = false;
+
 //! Global log level mask (0 = all logging disabled, per-bit enables log levels)
 #if defined(SKL_LOG_LEVEL_MASK)
 SKL_CACHE_ALIGNED std::relaxed_value<u32> g_skl_log_level_mask = u32(SKL_LOG_LEVEL_MASK);
@@ -73,11 +76,18 @@ private:
 SKL_MAKE_TLS_SINGLETON(slogger_sink_tls, g_sink_tls);
 
 namespace skl {
+bool slogger_async_submit(SLoggerSink& f_sink, skl_stream& f_log_stream) noexcept;
+void slogger_async_deinit_thread() noexcept;
+
 void slogger_register_sink(SLoggerSink* f_sink) noexcept {
     SKL_ASSERT_PERMANENT(nullptr != f_sink);
     g_skl_logger_sinks[f_sink->id()].store_release(f_sink);
 }
 
+void slogger_set_async_enabled(bool f_enabled) noexcept {
+    g_skl_log_async_enabled.store_release(f_enabled);
+}
+
 u32 skl_get_log_level_mask() noexcept {
     return g_skl_log_level_mask.load_acquire();
 }
@@ -101,6 +111,7 @@ skl_status SLoggerSinkManager::init_thread() noexcept {
 }
 
 void SLoggerSinkManager::deinit_thread() noexcept {
+    slogger_async_deinit_thread();
     g_sink_tls::tls_destroy();
 }
 
@@ -116,16 +127,6 @@ skl_status SLoggerSinkManager::register_custom_sink(SLoggerSink* f_sink) noexcep
     return SKL_SUCCESS;
 }
 
-skl_status SLoggerSinkManager::setup_network_sink(const slogger_net_sink_config_t& f_config) noexcept {
-    (void)f_config;
-    return SKL_ERR_NOT_IMPL;
-}
-
-skl_status SLoggerSinkManager::setup_file_sink(const slogger_file_sink_config_t& f_config) noexcept {
-    (void)f_config;
-    return SKL_ERR_NOT_IMPL;
-}
-
 skl_status SLoggerSinkManager::set_current_sink(slogger_sink_id_t f_id) noexcept {
     if ((f_id < CSLoggerNetSinkId) || (f_id > CSLoggerCustomSink)) {
         return SKL_ERR_PARAMS;
@@ -211,6 +212,12 @@ void slogger_sink_log() noexcept {
     auto& tls    = g_sink_tls::tls_checked();
     auto& buffer = skl_stream::make(tls.buffer());
     auto& sink   = tls.sink();
+
+    //Async mode, hand the serialized record to the back-end thread
+    if (g_skl_log_async_enabled.load_relaxed() && slogger_async_submit(sink, buffer)) {
+        [[likely]] return;
+    }
+
     sink.end_and_sink_log(buffer);
 }
 
@@ -219,6 +226,12 @@ void slogger_sink_log(slogger_sink_id_t f_specific_sink_id) noexcept {
     auto& buffer = skl_stream::make(tls.buffer());
     auto* sink   = g_skl_logger_sinks[f_specific_sink_id].load_relaxed();
     SKL_ASSERT(nullptr != sink);
+
+    //Async mode, hand the serialized record to the back-end thread
+    if (g_skl_log_async_enabled.load_relaxed() && slogger_async_submit(*sink, buffer)) {
+        [[likely]] return;
+    }
+
     sink->end_and_sink_log(buffer);
 }
 } // namespace skl
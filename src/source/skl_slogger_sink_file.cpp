@@ -0,0 +1,944 @@
+//!
+//! \file skl_slogger_sink_file
+//!
+//! \brief serialized logger file sink (batched, aligned buffers written by a dedicated thread)
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <cstdio>
+#include <ctime>
+#include <cerrno>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "skl_epoch"
+#include "skl_sleep"
+#include "skl_thread"
+#include "skl_stream"
+#include "skl_spin_lock"
+#include "skl_spsc_ring"
+#include "skl_logger/skl_slogger_sink.hpp"
+#include "skl_logger/skl_slogger_fend.hpp"
+#include "skl_logger/skl_slogger_bend.hpp"
+#include "skl_logger/skl_slogger_binary.hpp"
+
+namespace skl {
+void skl_core_init_thread__slog_bend() noexcept;
+void skl_core_deinit_thread__slog_bend() noexcept;
+void slogger_register_sink(SLoggerSink* f_sink) noexcept;
+} // namespace skl
+
+namespace {
+constexpr u64 CSLoggerFileSinkBlockSize       = 4096U;
+constexpr u64 CSLoggerFileSinkMaxRecordSize   = (skl::CSerializedLoggerFrontEndBufferMinSize * 2U) + 1U;
+constexpr u64 CSLoggerFileSinkStagingSize     = skl::CSLoggerFileSinkBufferSize + CSLoggerFileSinkBlockSize;
+constexpr u64 CSLoggerFileSinkMemorySize      = (skl::CSLoggerFileSinkBufferSize * skl::CSLoggerFileSinkBuffersCount) + CSLoggerFileSinkStagingSize;
+constexpr u32 CSLoggerFileSinkWriterPollUs    = 250U;
+constexpr u32 CSLoggerFileSinkRotatedNameSize = skl::CPathMaxLength + 24U;
+
+//! Binary format
+constexpr u32 CSLoggerBinaryNoId             = 0xFFFFFFFFU;
+constexpr u32 CSLoggerBinarySegmentEntrySize = 1U + u32(sizeof(skl::slogger_binary_segment_header_t));
+constexpr u32 CSLoggerBinaryDictEntrySize    = 1U + 4U + 4U; //[kind][u32 id][u32 length]
+constexpr u32 CSLoggerBinaryRecordEntrySize  = 1U + 2U;      //[kind][u16 size]
+constexpr u32 CSLoggerBinaryTableSize        = skl::CSLoggerBinaryDictionaryMaxEntries * 2U;
+
+static_assert((0U == (skl::CSLoggerFileSinkBufferSize % CSLoggerFileSinkBlockSize)) && (skl::CSLoggerFileSinkBufferSize >= (CSLoggerFileSinkMaxRecordSize * 2U)),
+              "SKL::CSLoggerFileSinkBufferSize must be a multiple of 4096 and fit at least 2 max sized formatted records!");
+static_assert((skl::CSLoggerFileSinkBuffersCount > 1U) && (0U == (skl::CSLoggerFileSinkBuffersCount & (skl::CSLoggerFileSinkBuffersCount - 1U))),
+              "SKL::CSLoggerFileSinkBuffersCount must be a power of 2!");
+
+[[nodiscard]] u64 slogger_file_sink_now_ns() noexcept {
+    timespec   tsc{};
+    const auto result = ::clock_gettime(CLOCK_MONOTONIC_RAW, &tsc);
+    SKL_ASSERT(-1 != result);
+    (void)result;
+    return (static_cast<u64>(tsc.tv_sec) * 1000000000ULL) + static_cast<u64>(tsc.tv_nsec);
+}
+
+//! [SingleWriter] Bump counter
+SKL_FORCEINLINE void slogger_file_sink_bump(std::relaxed_value<u64>& f_counter, u64 f_value = 1U) noexcept {
+    f_counter.store_relaxed(f_counter.load_relaxed() + f_value);
+}
+
+//! Highest N of the existing "<f_path>.<N>" rotated files (0 if none)
+[[nodiscard]] u64 slogger_file_sink_last_rotation_index(const char* f_path) noexcept {
+    char        directory[skl::CPathMaxLength];
+    const char* name = __builtin_strrchr(f_path, '/');
+    if (nullptr == name) {
+        directory[0] = '.';
+        directory[1] = 0;
+        name         = f_path;
+    } else {
+        const u64 length = (name == f_path) ? 1U : u64(name - f_path);
+        __builtin_memcpy(directory, f_path, length);
+        directory[length] = 0;
+        ++name;
+    }
+    const u64 name_length = __builtin_strlen(name);
+
+    DIR* dir = ::opendir(directory);
+    if (nullptr == dir) {
+        return 0U;
+    }
+
+    u64 result = 0U;
+    for (const dirent* entry = ::readdir(dir); nullptr != entry; entry = ::readdir(dir)) {
+        const char* entry_name = entry->d_name;
+        if ((0 != __builtin_strncmp(entry_name, name, name_length)) || ('.' != entry_name[name_length])) {
+            continue;
+        }
+
+        //"<name>.<digits>" only
+        const char* digits = entry_name + name_length + 1U;
+        u64         index  = 0U;
+        bool        valid  = 0 != digits[0];
+        for (const char* c = digits; valid && (0 != *c); ++c) {
+            valid = ('0' <= *c) && ('9' >= *c);
+            index = (index * 10U) + u64(*c - '0');
+        }
+        if (false == valid) {
+            continue;
+        }
+
+        //Rotated logs are regular files
+        bool is_file = DT_REG == entry->d_type;
+        if (DT_UNKNOWN == entry->d_type) {
+            struct stat entry_stat{};
+            is_file = (0 == ::fstatat(::dirfd(dir), entry_name, &entry_stat, 0)) && S_ISREG(entry_stat.st_mode);
+        }
+        if (is_file && (index > result)) {
+            result = index;
+        }
+    }
+
+    (void)::closedir(dir);
+    return result;
+}
+
+//! Formatted records buffer
+struct slogger_file_sink_buffer_t {
+    byte* m_data          = nullptr; //!< Page aligned, CSLoggerFileSinkBufferSize bytes
+    u64   m_size          = 0U;      //!< Used bytes
+    bool  m_rotate_before = false;   //!< [Binary] Rotate the file before writing this buffer (starts a new segment)
+};
+
+//! Binary format dictionary slot
+struct slogger_binary_dict_slot_t {
+    u64 m_hash;   //!< String hash (0 = empty slot)
+    u32 m_offset; //!< Offset in the strings arena
+    u32 m_length; //!< String length
+    u32 m_id;     //!< Interned string id
+};
+
+//! Binary format interned ids of a log call site
+struct slogger_binary_site_slot_t {
+    u32 m_segment; //!< Segment the ids were interned in (0 = never)
+    u32 m_file_id; //!< File name id
+    u32 m_fmt_id;  //!< Fmt string id
+};
+
+constexpr u64 CSLoggerBinaryDictionarySlotsSize  = sizeof(slogger_binary_dict_slot_t) * CSLoggerBinaryTableSize;
+constexpr u64 CSLoggerBinarySitesCacheSize       = sizeof(slogger_binary_site_slot_t) * (u64(skl::CSLoggerMaxLogSites) + 1U);
+constexpr u64 CSLoggerBinaryDictionaryMemorySize = CSLoggerBinaryDictionarySlotsSize + CSLoggerBinarySitesCacheSize + skl::CSLoggerBinaryDictionaryMaxBytes;
+
+[[nodiscard]] u64 slogger_binary_hash(const byte* f_data, u32 f_length) noexcept {
+    //FNV-1a
+    u64 hash = 0xCBF29CE484222325ULL;
+    for (u32 i = 0U; i < f_length; ++i) {
+        hash = (hash ^ u64(f_data[i])) * 0x100000001B3ULL;
+    }
+    return hash | 1U;
+}
+} // namespace
+
+namespace skl {
+struct LoggerFileSink final
+    : public SLoggerSink {
+    using buffers_ring_t = spsc_ring_t<slogger_file_sink_buffer_t*, CSLoggerFileSinkBuffersCount>;
+
+    LoggerFileSink() noexcept
+        : SLoggerSink(false, CSLoggerFileSinkId) { }
+
+    void thread_init() noexcept override {
+        //We need to initialize the backend processor on this thread
+        skl_core_init_thread__slog_bend();
+    }
+    void thread_deinit() noexcept override {
+        //We need to deinitialize the backend processor on this thread
+        skl_core_deinit_thread__slog_bend();
+    }
+
+    void begin_log(skl_stream& f_log_stream) noexcept override { }
+
+    void end_and_sink_log(skl_stream& f_log_stream) noexcept override {
+        if (m_is_binary.load_relaxed()) {
+            sink_binary(f_log_stream);
+            return;
+        }
+
+        //We are given the stream right after the log serilization is done, reset pos to 0
+        f_log_stream.reset();
+
+        //Format on the calling thread
+        const auto result = SKLSerializedLoggerBackend::process_no_colors(f_log_stream);
+        const u64  length = result.length();
+
+        lock_guard_t guard{m_lock};
+
+        if ((false == m_is_open) || m_is_binary.load_relaxed()) [[unlikely]] {
+            slogger_file_sink_bump(m_dropped_count);
+            return;
+        }
+
+        if ((nullptr == m_current) || ((m_current->m_size + length + 1U) > CSLoggerFileSinkBufferSize)) [[unlikely]] {
+            if (false == swap_current_buffer()) {
+                slogger_file_sink_bump(m_dropped_count);
+                return;
+            }
+        }
+
+        __builtin_memcpy(m_current->m_data + m_current->m_size, result.data(), length);
+        m_current->m_data[m_current->m_size + length] = '\n';
+        m_current->m_size += length + 1U;
+
+        slogger_file_sink_bump(m_records_count);
+    }
+
+    [[nodiscard]] skl_status open(const slogger_file_sink_config_t& f_config) noexcept {
+        if ((nullptr == f_config.m_file_path) || (0 == f_config.m_file_path[0])) {
+            return SKL_ERR_PARAMS;
+        }
+
+        const auto path = skl_string_view::from_cstr(f_config.m_file_path);
+        if (path.length() >= CPathMaxLength) {
+            return SKL_ERR_PARAMS;
+        }
+
+        lock_guard_t guard{m_setup_lock};
+
+        if (m_is_open) {
+            return SKL_ERR_STATE;
+        }
+
+        path.copy_and_terminate(m_path);
+        m_config             = f_config;
+        m_config.m_file_path = m_path;
+
+        const bool is_binary = ESLoggerFileSinkFormat::Binary == m_config.m_format;
+        if (is_binary) {
+            void* dictionary = ::mmap(nullptr, CSLoggerBinaryDictionaryMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (MAP_FAILED == dictionary) {
+                return SKL_ERR_ALLOC;
+            }
+            m_dict_slots   = reinterpret_cast<slogger_binary_dict_slot_t*>(dictionary);
+            m_dict_sites   = reinterpret_cast<slogger_binary_site_slot_t*>(reinterpret_cast<byte*>(dictionary) + CSLoggerBinaryDictionarySlotsSize);
+            m_dict_strings = reinterpret_cast<byte*>(dictionary) + CSLoggerBinaryDictionarySlotsSize + CSLoggerBinarySitesCacheSize;
+            m_dict_segment = 0U;
+        }
+
+        //All buffers and the O_DIRECT staging buffer in one page aligned block
+        void* memory = ::mmap(nullptr, CSLoggerFileSinkMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (MAP_FAILED == memory) {
+            release_dictionary();
+            return SKL_ERR_ALLOC;
+        }
+        m_memory = reinterpret_cast<byte*>(memory);
+
+        //Continue the numbering of the rotated files left by previous runs
+        m_rotation_index = slogger_file_sink_last_rotation_index(m_path);
+
+        if (false == open_file(false == m_config.m_truncate)) {
+            (void)::munmap(m_memory, CSLoggerFileSinkMemorySize);
+            m_memory = nullptr;
+            release_dictionary();
+            return SKL_ERR_FILE;
+        }
+
+        //All buffers are free
+        for (u64 i = 0U; i < CSLoggerFileSinkBuffersCount; ++i) {
+            m_buffers[i].m_data          = m_memory + (i * CSLoggerFileSinkBufferSize);
+            m_buffers[i].m_size          = 0U;
+            m_buffers[i].m_rotate_before = false;
+            m_free_buffers.allocate_checked() = &m_buffers[i];
+        }
+        m_free_buffers.submit();
+        m_current    = nullptr;
+        m_last_flush = get_current_epoch_time();
+
+        {
+            lock_guard_t sink_guard{m_lock};
+            m_is_binary.store_relaxed(is_binary);
+            m_binary_needs_segment  = true;
+            m_binary_file_size      = m_file_size;
+            m_binary_segment_opened = m_last_flush;
+            m_is_open               = true;
+        }
+
+        m_running.store_release(true);
+        m_writer.set_handler([this]() noexcept -> i32 { return run_writer(); });
+        if (m_writer.create().is_failure()) {
+            m_running.store_release(false);
+            {
+                lock_guard_t sink_guard{m_lock};
+                m_is_open = false;
+            }
+            reset_buffers_rings();
+            close_file();
+            (void)::munmap(m_memory, CSLoggerFileSinkMemorySize);
+            m_memory = nullptr;
+            release_dictionary();
+            return SKL_ERR_THREAD;
+        }
+
+        return SKL_SUCCESS;
+    }
+
+    [[nodiscard]] skl_status close() noexcept {
+        lock_guard_t guard{m_setup_lock};
+
+        {
+            lock_guard_t sink_guard{m_lock};
+            if (false == m_is_open) {
+                return SKL_OK_REDUNDANT;
+            }
+            m_is_open = false;
+
+            //Hand the partially filled buffer to the writer
+            hand_off_current();
+            m_current = nullptr;
+        }
+
+        //The writer drains all full buffers before exiting
+        m_running.store_release(false);
+        (void)m_writer.join();
+
+        close_file();
+        reset_buffers_rings();
+
+        (void)::munmap(m_memory, CSLoggerFileSinkMemorySize);
+        m_memory = nullptr;
+        release_dictionary();
+
+        return SKL_SUCCESS;
+    }
+
+    [[nodiscard]] slogger_file_sink_stats_t stats() noexcept {
+        slogger_file_sink_stats_t result{};
+        {
+            lock_guard_t sink_guard{m_lock};
+            result.m_records_count  = m_records_count.load_relaxed();
+            result.m_dropped_count  = m_dropped_count.load_relaxed();
+            result.m_interned_count = m_interned_count.load_relaxed();
+        }
+        result.m_written_bytes          = m_written_bytes.load_acquire();
+        result.m_flush_count            = m_flush_count.load_acquire();
+        result.m_flush_latency_total_ns = m_flush_latency_total_ns.load_acquire();
+        result.m_flush_latency_max_ns   = m_flush_latency_max_ns.load_acquire();
+        result.m_rotations_count        = m_rotations_count.load_acquire();
+        result.m_write_errors_count     = m_write_errors_count.load_acquire();
+        result.m_is_direct_io           = m_is_direct_io.load_acquire();
+        return result;
+    }
+
+private:
+    //! [Locked] Hand the current buffer (if any data) to the writer and take a free one
+    //! \returns false if no free buffer is available
+    [[nodiscard]] bool swap_current_buffer() noexcept {
+        hand_off_current();
+
+        if (nullptr == m_current) {
+            slogger_file_sink_buffer_t** free_buffer = nullptr;
+            if (0U == m_free_buffers.dequeue_burst(&free_buffer, 1U)) {
+                return false;
+            }
+            m_current = *free_buffer;
+            m_free_buffers.free_processed();
+            m_current->m_size          = 0U;
+            m_current->m_rotate_before = false;
+
+            //Binary files are rotated at buffer boundaries so each file starts with its own segment (dictionary)
+            if (m_is_binary.load_relaxed() && (false == m_binary_needs_segment) && should_rotate_binary()) {
+                m_current->m_rotate_before = true;
+                m_binary_needs_segment     = true;
+                m_binary_file_size         = 0U;
+                m_binary_segment_opened    = get_current_epoch_time();
+            }
+        }
+
+        return true;
+    }
+
+    //! [Locked] Hand the current buffer (if any data) to the writer
+    void hand_off_current() noexcept {
+        if ((nullptr != m_current) && (0U < m_current->m_size)) {
+            //There are as many full buffer slots as buffers
+            m_binary_file_size += m_current->m_size;
+            m_full_buffers.allocate_checked() = m_current;
+            m_full_buffers.submit();
+            m_current = nullptr;
+        }
+    }
+
+    //! [Locked][Binary] Is the current binary file due for rotation
+    [[nodiscard]] bool should_rotate_binary() const noexcept {
+        if (0U == m_binary_file_size) {
+            return false;
+        }
+        if ((0U < m_config.m_rotate_size_bytes) && (m_binary_file_size >= m_config.m_rotate_size_bytes)) {
+            return true;
+        }
+        return (0U < m_config.m_rotate_interval_ms) && ((get_current_epoch_time() - m_binary_segment_opened) >= m_config.m_rotate_interval_ms);
+    }
+
+    //! [Binary] Sink the raw record, interning the file name and fmt string
+    void sink_binary(skl_stream& f_log_stream) noexcept {
+        constexpr u32 CTypeOffset = 4U + 2U;
+
+        //We are given the stream right after the log serilization is done, the position is the record size
+        const byte* record = f_log_stream.buffer();
+        const u32   length = f_log_stream.position();
+
+        //[u32 timestamp][u16 uid][u8 type][u16 line]
+        byte              fixed[CSLoggerBinaryRecordFixedSize];
+        const byte*       file_name;
+        const byte*       fmt;
+        u32               file_length;
+        u32               fmt_length;
+        u32               rest_offset;
+        slogger_site_id_t site_id = CSLoggerNoSiteId;
+
+        if (0U != (record[CTypeOffset] & CSLoggerSiteRecordFlag)) [[likely]] {
+            //[u32 timestamp][u16 uid][u8 type][u32 site id][u16 args count][args]
+            rest_offset = CTypeOffset + 1U + u32(sizeof(slogger_site_id_t));
+            SKL_ASSERT((rest_offset + 2U) <= length);
+
+            __builtin_memcpy(&site_id, record + CTypeOffset + 1U, sizeof(site_id));
+            const auto* site = skl_get_log_site(site_id);
+            if (nullptr == site) [[unlikely]] {
+                lock_guard_t guard{m_lock};
+                slogger_file_sink_bump(m_dropped_count);
+                return;
+            }
+
+            __builtin_memcpy(fixed, record, CTypeOffset);
+            fixed[CTypeOffset] = byte(record[CTypeOffset] & ~CSLoggerSiteRecordFlag);
+            __builtin_memcpy(fixed + CTypeOffset + 1U, &site->m_line_number, sizeof(u16));
+
+            file_name   = reinterpret_cast<const byte*>(site->m_file_name.data());
+            file_length = u32(site->m_file_name.length());
+            fmt         = reinterpret_cast<const byte*>(site->m_fmt_string.data());
+            fmt_length  = u32(site->m_fmt_string.length());
+        } else {
+            //[fixed][u32 len][file name][u32 len][fmt string][u16 args count][args]
+            SKL_ASSERT((CSLoggerBinaryRecordFixedSize + 8U + 2U) <= length);
+            __builtin_memcpy(fixed, record, CSLoggerBinaryRecordFixedSize);
+
+            skl_stream::str_len_prefix_t file_prefix;
+            skl_stream::str_len_prefix_t fmt_prefix;
+            __builtin_memcpy(&file_prefix, record + CSLoggerBinaryRecordFixedSize, sizeof(file_prefix));
+            const u32 fmt_offset = CSLoggerBinaryRecordFixedSize + u32(sizeof(file_prefix)) + file_prefix;
+            __builtin_memcpy(&fmt_prefix, record + fmt_offset, sizeof(fmt_prefix));
+            rest_offset = fmt_offset + u32(sizeof(fmt_prefix)) + fmt_prefix;
+            SKL_ASSERT(rest_offset <= length);
+
+            file_name   = record + CSLoggerBinaryRecordFixedSize + sizeof(file_prefix);
+            file_length = file_prefix;
+            fmt         = record + fmt_offset + sizeof(fmt_prefix);
+            fmt_length  = fmt_prefix;
+        }
+
+        const u32 rest_length = length - rest_offset;
+
+        //Size of the record with the strings inline, the decoder rebuilds it
+        const u64 raw_length = u64(CSLoggerBinaryRecordFixedSize) + (sizeof(skl_stream::str_len_prefix_t) * 2U) + file_length + fmt_length + rest_length;
+
+        //Worst case: new segment, both strings interned and the record
+        const u64 required = CSLoggerBinarySegmentEntrySize
+                           + (CSLoggerBinaryDictEntrySize * 2U) + file_length + fmt_length
+                           + CSLoggerBinaryRecordEntrySize + raw_length;
+
+        lock_guard_t guard{m_lock};
+
+        if ((false == m_is_open) || (false == m_is_binary.load_relaxed()) || (raw_length > CSerializedLoggerThreadBufferSize)) [[unlikely]] {
+            slogger_file_sink_bump(m_dropped_count);
+            return;
+        }
+
+        if ((nullptr == m_current) || ((m_current->m_size + required) > CSLoggerFileSinkBufferSize)) [[unlikely]] {
+            if (false == swap_current_buffer()) {
+                slogger_file_sink_bump(m_dropped_count);
+                return;
+            }
+        }
+
+        if (m_binary_needs_segment) [[unlikely]] {
+            begin_binary_segment();
+        }
+
+        //Registered call sites skip the string hashing once interned in the current segment
+        auto* site_slot = (CSLoggerNoSiteId != site_id) ? &m_dict_sites[site_id] : nullptr;
+
+        u32 file_id;
+        u32 fmt_id;
+        if ((nullptr != site_slot) && (m_dict_segment == site_slot->m_segment)) [[likely]] {
+            file_id = site_slot->m_file_id;
+            fmt_id  = site_slot->m_fmt_id;
+        } else {
+            file_id = intern_binary(file_name, file_length);
+            fmt_id  = (CSLoggerBinaryNoId != file_id) ? intern_binary(fmt, fmt_length) : CSLoggerBinaryNoId;
+            if ((nullptr != site_slot) && (CSLoggerBinaryNoId != fmt_id)) {
+                *site_slot = {m_dict_segment, file_id, fmt_id};
+            }
+        }
+
+        byte* front = m_current->m_data + m_current->m_size;
+        if (CSLoggerBinaryNoId != fmt_id) [[likely]] {
+            const u16 size = u16(CSLoggerBinaryRecordFixedSize + 8U + rest_length);
+
+            front[0] = byte(ESLoggerBinaryEntry::Record);
+            __builtin_memcpy(front + 1U, &size, sizeof(size));
+            front += CSLoggerBinaryRecordEntrySize;
+            __builtin_memcpy(front, fixed, CSLoggerBinaryRecordFixedSize);
+            __builtin_memcpy(front + CSLoggerBinaryRecordFixedSize, &file_id, sizeof(file_id));
+            __builtin_memcpy(front + CSLoggerBinaryRecordFixedSize + 4U, &fmt_id, sizeof(fmt_id));
+            __builtin_memcpy(front + CSLoggerBinaryRecordFixedSize + 8U, record + rest_offset, rest_length);
+            m_current->m_size += CSLoggerBinaryRecordEntrySize + size;
+        } else {
+            //Dictionary full, keep the strings inline
+            const u16 size = u16(raw_length);
+            front[0]       = byte(ESLoggerBinaryEntry::RawRecord);
+            __builtin_memcpy(front + 1U, &size, sizeof(size));
+            front += CSLoggerBinaryRecordEntrySize;
+            __builtin_memcpy(front, fixed, CSLoggerBinaryRecordFixedSize);
+            front += CSLoggerBinaryRecordFixedSize;
+            __builtin_memcpy(front, &file_length, sizeof(u32));
+            __builtin_memcpy(front + sizeof(u32), file_name, file_length);
+            front += sizeof(u32) + file_length;
+            __builtin_memcpy(front, &fmt_length, sizeof(u32));
+            __builtin_memcpy(front + sizeof(u32), fmt, fmt_length);
+            front += sizeof(u32) + fmt_length;
+            __builtin_memcpy(front, record + rest_offset, rest_length);
+            m_current->m_size += CSLoggerBinaryRecordEntrySize + size;
+        }
+
+        slogger_file_sink_bump(m_records_count);
+    }
+
+    //! [Locked][Binary] Write the segment entry into the current buffer and reset the dictionary
+    void begin_binary_segment() noexcept {
+        slogger_binary_segment_header_t header{};
+        header.m_magic          = CSLoggerBinaryMagic;
+        header.m_version        = CSLoggerBinaryVersion;
+        header.m_start_epoch_ms = get_current_epoch_time();
+
+        byte* front = m_current->m_data + m_current->m_size;
+        front[0]    = byte(ESLoggerBinaryEntry::Segment);
+        __builtin_memcpy(front + 1U, &header, sizeof(header));
+        m_current->m_size += CSLoggerBinarySegmentEntrySize;
+
+        __builtin_memset(m_dict_slots, 0, CSLoggerBinaryDictionarySlotsSize);
+        ++m_dict_segment;
+        m_dict_count           = 0U;
+        m_dict_strings_size    = 0U;
+        m_binary_needs_segment = false;
+    }
+
+    //! [Locked][Binary] Get the id of the given string, writes the dictionary entry if not interned yet
+    //! \returns CSLoggerBinaryNoId if the dictionary is full
+    [[nodiscard]] u32 intern_binary(const byte* f_string, u32 f_length) noexcept {
+        const u64 hash = slogger_binary_hash(f_string, f_length);
+
+        u32 index = u32(hash) & (CSLoggerBinaryTableSize - 1U);
+        for (;;) {
+            auto& slot = m_dict_slots[index];
+            if (0U == slot.m_hash) {
+                break;
+            }
+            if ((hash == slot.m_hash) && (f_length == slot.m_length) && (0 == __builtin_memcmp(m_dict_strings + slot.m_offset, f_string, f_length))) [[likely]] {
+                return slot.m_id;
+            }
+            index = (index + 1U) & (CSLoggerBinaryTableSize - 1U);
+        }
+
+        if ((CSLoggerBinaryDictionaryMaxEntries == m_dict_count) || ((m_dict_strings_size + f_length) > CSLoggerBinaryDictionaryMaxBytes)) [[unlikely]] {
+            return CSLoggerBinaryNoId;
+        }
+
+        auto& slot    = m_dict_slots[index];
+        slot.m_hash   = hash;
+        slot.m_offset = u32(m_dict_strings_size);
+        slot.m_length = f_length;
+        slot.m_id     = m_dict_count++;
+        __builtin_memcpy(m_dict_strings + m_dict_strings_size, f_string, f_length);
+        m_dict_strings_size += f_length;
+
+        byte* front = m_current->m_data + m_current->m_size;
+        front[0]    = byte(ESLoggerBinaryEntry::Dictionary);
+        __builtin_memcpy(front + 1U, &slot.m_id, sizeof(u32));
+        __builtin_memcpy(front + 5U, &f_length, sizeof(u32));
+        __builtin_memcpy(front + CSLoggerBinaryDictEntrySize, f_string, f_length);
+        m_current->m_size += CSLoggerBinaryDictEntrySize + f_length;
+
+        slogger_file_sink_bump(m_interned_count);
+
+        return slot.m_id;
+    }
+
+    void release_dictionary() noexcept {
+        if (nullptr != m_dict_slots) {
+            (void)::munmap(m_dict_slots, CSLoggerBinaryDictionaryMemorySize);
+            m_dict_slots   = nullptr;
+            m_dict_sites   = nullptr;
+            m_dict_strings = nullptr;
+        }
+    }
+
+    //! Drop all buffers from the rings (no producer and no writer running)
+    void reset_buffers_rings() noexcept {
+        slogger_file_sink_buffer_t** buffers[CSLoggerFileSinkBuffersCount];
+        while (0U < m_free_buffers.dequeue_burst(buffers, CSLoggerFileSinkBuffersCount)) {
+            m_free_buffers.free_processed();
+        }
+        while (0U < m_full_buffers.dequeue_burst(buffers, CSLoggerFileSinkBuffersCount)) {
+            m_full_buffers.free_processed();
+        }
+    }
+
+    [[nodiscard]] bool open_file(bool f_append) noexcept {
+        i32 flags = O_WRONLY | O_CREAT | O_CLOEXEC;
+        if (false == f_append) {
+            flags |= O_TRUNC;
+        }
+
+        bool is_direct_io = false;
+        i32  fd           = -1;
+        if (m_config.m_use_direct_io) {
+            fd           = ::open(m_path, flags | O_DIRECT, 0644);
+            is_direct_io = (-1 != fd);
+            if (false == is_direct_io) {
+                (void)printf("[SLogger] File sink: O_DIRECT not supported for %s (errno %d), using buffered I/O!\n", m_path, errno);
+            }
+        }
+        if (-1 == fd) {
+            fd = ::open(m_path, flags, 0644);
+            if (-1 == fd) {
+                (void)printf("[SLogger] File sink: Failed to open %s (errno %d)!\n", m_path, errno);
+                return false;
+            }
+        }
+
+        struct stat file_stat{};
+        if (0 != ::fstat(fd, &file_stat)) {
+            (void)::close(fd);
+            return false;
+        }
+
+        //Buffered writes continue at the end of the existing file (O_DIRECT writes use explicit offsets)
+        if ((false == is_direct_io) && (-1 == ::lseek(fd, 0, SEEK_END))) {
+            (void)::close(fd);
+            return false;
+        }
+
+        m_fd            = fd;
+        m_file_size     = u64(file_stat.st_size);
+        m_file_opened   = get_current_epoch_time();
+        m_staging_size  = 0U;
+        m_write_offset  = m_file_size;
+        m_is_direct_io.store_release(is_direct_io);
+
+        //O_DIRECT writes whole blocks, reload the unaligned tail of the existing file into the staging buffer
+        if (is_direct_io) {
+            m_write_offset = m_file_size & ~(CSLoggerFileSinkBlockSize - 1U);
+            m_staging_size = m_file_size - m_write_offset;
+            if (0U < m_staging_size) {
+                const i32 read_fd = ::open(m_path, O_RDONLY | O_CLOEXEC);
+                if ((-1 == read_fd) || (i64(m_staging_size) != ::pread(read_fd, staging(), m_staging_size, i64(m_write_offset)))) {
+                    if (-1 != read_fd) {
+                        (void)::close(read_fd);
+                    }
+                    (void)::close(fd);
+                    m_fd = -1;
+                    return false;
+                }
+                (void)::close(read_fd);
+            }
+        }
+
+        return true;
+    }
+
+    void close_file() noexcept {
+        if (-1 == m_fd) {
+            return;
+        }
+
+        if (m_is_direct_io.load_relaxed() && (0U < m_staging_size)) {
+            //Write the last (zero padded) block and cut the file to the real size
+            __builtin_memset(staging() + m_staging_size, 0, CSLoggerFileSinkBlockSize - m_staging_size);
+            if (i64(CSLoggerFileSinkBlockSize) == ::pwrite(m_fd, staging(), CSLoggerFileSinkBlockSize, i64(m_write_offset))) {
+                (void)::ftruncate(m_fd, i64(m_write_offset + m_staging_size));
+            } else {
+                slogger_file_sink_bump(m_write_errors_count);
+            }
+            m_staging_size = 0U;
+        }
+
+        (void)::close(m_fd);
+        m_fd = -1;
+    }
+
+    void rotate_file() noexcept {
+        close_file();
+
+        char rotated_path[CSLoggerFileSinkRotatedNameSize];
+        (void)snprintf(rotated_path, sizeof(rotated_path), "%s.%llu", m_path, static_cast<unsigned long long>(m_rotation_index + 1U));
+        if (0 != ::rename(m_path, rotated_path)) {
+            //Keep writing at the end of the current file, its records must not be truncated away
+            (void)printf("[SLogger] File sink: Failed to rotate %s (errno %d)!\n", m_path, errno);
+            slogger_file_sink_bump(m_write_errors_count);
+            if (false == open_file(true)) {
+                slogger_file_sink_bump(m_write_errors_count);
+            }
+            return;
+        }
+        ++m_rotation_index;
+        slogger_file_sink_bump(m_rotations_count);
+
+        if (false == open_file(false)) {
+            slogger_file_sink_bump(m_write_errors_count);
+        }
+    }
+
+    [[nodiscard]] byte* staging() noexcept {
+        return m_memory + (CSLoggerFileSinkBufferSize * CSLoggerFileSinkBuffersCount);
+    }
+
+    //! [Writer] Write all bytes
+    [[nodiscard]] bool write_all(const byte* f_data, u64 f_size) noexcept {
+        while (0U < f_size) {
+            const auto written = ::write(m_fd, f_data, f_size);
+            if (0 > written) {
+                if (EINTR == errno) {
+                    continue;
+                }
+                return false;
+            }
+            f_data += written;
+            f_size -= u64(written);
+        }
+        return true;
+    }
+
+    //! [Writer] Write the given buffers in one batch
+    void write_buffers(slogger_file_sink_buffer_t* const* f_buffers, u32 f_count) noexcept {
+        if (-1 == m_fd) [[unlikely]] {
+            slogger_file_sink_bump(m_write_errors_count);
+            return;
+        }
+
+        const u64 start = slogger_file_sink_now_ns();
+        u64       bytes = 0U;
+        bool      ok    = true;
+
+        if (m_is_direct_io.load_relaxed()) {
+            //Append to staging and write all whole blocks, keep the tail for the next batch
+            for (u32 i = 0U; (i < f_count) && ok; ++i) {
+                const auto& buffer = *f_buffers[i];
+                __builtin_memcpy(staging() + m_staging_size, buffer.m_data, buffer.m_size);
+                m_staging_size += buffer.m_size;
+                bytes += buffer.m_size;
+
+                const u64 aligned = m_staging_size & ~(CSLoggerFileSinkBlockSize - 1U);
+                if (0U < aligned) {
+                    ok = (i64(aligned) == ::pwrite(m_fd, staging(), aligned, i64(m_write_offset)));
+                    m_write_offset += aligned;
+                    m_staging_size -= aligned;
+                    __builtin_memmove(staging(), staging() + aligned, m_staging_size);
+                }
+            }
+        } else {
+            iovec iov[CSLoggerFileSinkBuffersCount];
+            for (u32 i = 0U; i < f_count; ++i) {
+                iov[i].iov_base = f_buffers[i]->m_data;
+                iov[i].iov_len  = f_buffers[i]->m_size;
+                bytes += f_buffers[i]->m_size;
+            }
+
+            const auto written = ::writev(m_fd, iov, i32(f_count));
+            if (written != i64(bytes)) {
+                //Partial write, write the rest buffer by buffer
+                u64 skip = (0 > written) ? 0U : u64(written);
+                for (u32 i = 0U; (i < f_count) && ok; ++i) {
+                    const u64 size = f_buffers[i]->m_size;
+                    if (skip >= size) {
+                        skip -= size;
+                        continue;
+                    }
+                    ok   = write_all(f_buffers[i]->m_data + skip, size - skip);
+                    skip = 0U;
+                }
+            }
+        }
+
+        const u64 latency = slogger_file_sink_now_ns() - start;
+
+        if (false == ok) [[unlikely]] {
+            slogger_file_sink_bump(m_write_errors_count);
+        }
+
+        m_file_size += bytes;
+        slogger_file_sink_bump(m_written_bytes, bytes);
+        slogger_file_sink_bump(m_flush_count);
+        slogger_file_sink_bump(m_flush_latency_total_ns, latency);
+        if (latency > m_flush_latency_max_ns.load_relaxed()) {
+            m_flush_latency_max_ns.store_relaxed(latency);
+        }
+    }
+
+    //! [Writer] Writer thread body
+    [[nodiscard]] i32 run_writer() noexcept {
+        slogger_file_sink_buffer_t** dequeued[CSLoggerFileSinkBuffersCount];
+        slogger_file_sink_buffer_t*  buffers[CSLoggerFileSinkBuffersCount];
+        const bool                   is_binary = ESLoggerFileSinkFormat::Binary == m_config.m_format;
+
+        for (;;) {
+            const bool is_running = m_running.load_acquire();
+
+            const u32 count = m_full_buffers.dequeue_burst(dequeued, CSLoggerFileSinkBuffersCount);
+            if (0U < count) {
+                for (u32 i = 0U; i < count; ++i) {
+                    buffers[i] = *dequeued[i];
+                }
+                m_full_buffers.free_processed();
+
+                //Binary mode rotations are decided by the sink at buffer boundaries
+                u32 first = 0U;
+                for (u32 i = 0U; i < count; ++i) {
+                    if (buffers[i]->m_rotate_before) {
+                        if (i > first) {
+                            write_buffers(buffers + first, i - first);
+                        }
+                        rotate_file();
+                        first = i;
+                    }
+                }
+                write_buffers(buffers + first, count - first);
+
+                //Give back the buffers
+                for (u32 i = 0U; i < count; ++i) {
+                    buffers[i]->m_size                = 0U;
+                    buffers[i]->m_rotate_before       = false;
+                    m_free_buffers.allocate_checked() = buffers[i];
+                }
+                m_free_buffers.submit();
+
+                m_last_flush = get_current_epoch_time();
+
+                if ((false == is_binary) && (0U < m_config.m_rotate_size_bytes) && (m_file_size >= m_config.m_rotate_size_bytes)) {
+                    rotate_file();
+                }
+                continue;
+            }
+
+            if (false == is_running) {
+                break;
+            }
+
+            const auto now = get_current_epoch_time();
+
+            //Flush the partially filled buffer
+            if ((now - m_last_flush) >= m_config.m_flush_interval_ms) {
+                m_last_flush = now;
+
+                lock_guard_t sink_guard{m_lock};
+                if (m_is_open) {
+                    hand_off_current();
+                }
+                continue;
+            }
+
+            if ((false == is_binary) && (0U < m_config.m_rotate_interval_ms) && ((now - m_file_opened) >= m_config.m_rotate_interval_ms) && (0U < m_file_size)) {
+                rotate_file();
+                continue;
+            }
+
+            skl_usleep(CSLoggerFileSinkWriterPollUs);
+        }
+
+        return 0;
+    }
+
+private:
+    spin_lock_t                 m_lock;                //!< Guards the current buffer and the producer side of the buffer rings
+    spin_lock_t                 m_setup_lock;          //!< Guards open/close
+    bool                        m_is_open = false;     //!< [m_lock] Accepting records
+    slogger_file_sink_buffer_t* m_current = nullptr;   //!< [m_lock] Buffer being filled
+    std::relaxed_value<u64>     m_records_count{0U};   //!< [m_lock] Records formatted into buffers
+    std::relaxed_value<u64>     m_dropped_count{0U};   //!< [m_lock] Records dropped
+    std::relaxed_value<u64>     m_interned_count{0U};  //!< [m_lock] Strings interned
+    std::relaxed_value<bool>    m_is_binary{false};    //!< Binary format
+    buffers_ring_t              m_full_buffers;        //!< {Sink -> Writer} Buffers pending write
+    buffers_ring_t              m_free_buffers;        //!< {Writer -> Sink} Written buffers
+
+    slogger_file_sink_buffer_t m_buffers[CSLoggerFileSinkBuffersCount]; //!< All buffers
+    byte*                      m_memory = nullptr;                      //!< Buffers memory
+
+    bool                        m_binary_needs_segment  = false;   //!< [m_lock] Next record starts a new segment
+    u64                         m_binary_file_size      = 0U;      //!< [m_lock] Bytes handed to the writer for the current file
+    epoch_time_point_t          m_binary_segment_opened = 0U;      //!< [m_lock] Epoch time the current binary file was started
+    slogger_binary_dict_slot_t* m_dict_slots            = nullptr; //!< [m_lock] Dictionary hash table
+    slogger_binary_site_slot_t* m_dict_sites            = nullptr; //!< [m_lock] Interned ids per log call site (indexed by site id)
+    u32                         m_dict_segment          = 0U;      //!< [m_lock] Current segment index (validates the site slots)
+    byte*                       m_dict_strings          = nullptr; //!< [m_lock] Dictionary strings arena
+    u32                         m_dict_count            = 0U;      //!< [m_lock] Interned strings in the current segment
+    u64                         m_dict_strings_size     = 0U;      //!< [m_lock] Used bytes of the strings arena
+
+    slogger_file_sink_config_t m_config{};               //!< Current config
+    char                       m_path[CPathMaxLength]{}; //!< Current file path
+    SKLThread                  m_writer{skl_string_view::exact_cstr("SKL SLogger File")};
+    std::relaxed_value<bool>   m_running{false};
+
+    i32                m_fd             = -1; //!< [Writer] File descriptor
+    u64                m_file_size      = 0U; //!< [Writer] Current file size
+    u64                m_write_offset   = 0U; //!< [Writer] O_DIRECT write offset (block aligned)
+    u64                m_staging_size   = 0U; //!< [Writer] O_DIRECT pending tail size
+    epoch_time_point_t m_file_opened    = 0U; //!< [Writer] Epoch time the file was opened
+    epoch_time_point_t m_last_flush     = 0U; //!< [Writer] Epoch time of the last flush
+    u64                m_rotation_index = 0U; //!< [Writer] N of the last "<path>.<N>" rotated file
+
+    std::relaxed_value<u64>  m_written_bytes{0U};
+    std::relaxed_value<u64>  m_flush_count{0U};
+    std::relaxed_value<u64>  m_flush_latency_total_ns{0U};
+    std::relaxed_value<u64>  m_flush_latency_max_ns{0U};
+    std::relaxed_value<u64>  m_rotations_count{0U};
+    std::relaxed_value<u64>  m_write_errors_count{0U};
+    std::relaxed_value<bool> m_is_direct_io{false};
+};
+} // namespace skl
+
+namespace {
+SKL_CACHE_ALIGNED skl::LoggerFileSink g_skl_file_log_sink;
+}
+
+namespace skl {
+skl_status SLoggerSinkManager::setup_file_sink(const slogger_file_sink_config_t& f_config) noexcept {
+    const auto result = g_skl_file_log_sink.open(f_config);
+    if (result.is_success()) {
+        slogger_register_sink(&g_skl_file_log_sink);
+    }
+    return result;
+}
+
+skl_status SLoggerSinkManager::close_file_sink() noexcept {
+    return g_skl_file_log_sink.close();
+}
+
+slogger_file_sink_stats_t SLoggerSinkManager::get_file_sink_stats() noexcept {
+    return g_skl_file_log_sink.stats();
+}
+} // namespace skl
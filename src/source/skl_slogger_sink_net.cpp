@@ -0,0 +1,411 @@
+//!
+//! \file skl_slogger_sink_net
+//!
+//! \brief serialized logger network sink (raw records packed into udp datagrams sent by a dedicated thread)
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <cerrno>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+
+#include "skl_epoch"
+#include "skl_sleep"
+#include "skl_thread"
+#include "skl_stream"
+#include "skl_spin_lock"
+#include "skl_spsc_ring"
+#include "skl_logger/skl_slogger_net.hpp"
+#include "skl_logger/skl_slogger_sink.hpp"
+
+namespace skl {
+void slogger_register_sink(SLoggerSink* f_sink) noexcept;
+u32  slogger_expand_raw_record(const byte* f_record, u32 f_length, byte* f_out, u32 f_capacity) noexcept;
+} // namespace skl
+
+namespace {
+constexpr u32 CSLoggerNetSinkSendBatch       = 32U;
+constexpr u32 CSLoggerNetSinkSenderPollUs    = 100U;
+constexpr u16 CSLoggerNetSinkMinDatagramSize = 256U;
+constexpr u32 CSLoggerNetSinkMaxRecordsCount = 0xFFU;
+
+static_assert((skl::CSLoggerNetSinkDatagramsCount > CSLoggerNetSinkSendBatch) && (0U == (skl::CSLoggerNetSinkDatagramsCount & (skl::CSLoggerNetSinkDatagramsCount - 1U))),
+              "SKL::CSLoggerNetSinkDatagramsCount must be a power of 2 and greater than the send batch!");
+
+//! [SingleWriter] Bump counter
+SKL_FORCEINLINE void slogger_net_sink_bump(std::relaxed_value<u64>& f_counter, u64 f_value = 1U) noexcept {
+    f_counter.store_relaxed(f_counter.load_relaxed() + f_value);
+}
+
+//! Datagram buffer
+struct slogger_net_sink_datagram_t {
+    u32  m_size;                                      //!< Used bytes (including the header)
+    u32  m_records_count;                             //!< Count of packed records
+    byte m_data[skl::CSLoggerNetMaxDatagramCapacity]; //!< [Header][u16 length][record]...
+};
+
+constexpr u64 CSLoggerNetSinkMemorySize = sizeof(slogger_net_sink_datagram_t) * skl::CSLoggerNetSinkDatagramsCount;
+} // namespace
+
+namespace skl {
+struct LoggerNetworkSink final
+    : public SLoggerSink {
+    using datagrams_ring_t = spsc_ring_t<slogger_net_sink_datagram_t*, CSLoggerNetSinkDatagramsCount>;
+
+    LoggerNetworkSink() noexcept
+        : SLoggerSink(false, CSLoggerNetSinkId) { }
+
+    //No formatting is done on the logging thread
+    void thread_init() noexcept override { }
+    void thread_deinit() noexcept override { }
+
+    void begin_log(skl_stream& f_log_stream) noexcept override { }
+
+    void end_and_sink_log(skl_stream& f_log_stream) noexcept override {
+        //We are given the stream right after the log serilization is done, the position is the record size
+        const u32 length = f_log_stream.position();
+        SKL_ASSERT((0U < length) && (length <= CSerializedLoggerThreadBufferSize));
+
+        lock_guard_t guard{m_lock};
+
+        if (false == m_is_open) [[unlikely]] {
+            slogger_net_sink_bump(m_dropped_count);
+            return;
+        }
+
+        if ((nullptr == m_current) || (CSLoggerNetSinkMaxRecordsCount == m_current->m_records_count)) [[unlikely]] {
+            if (false == swap_current_datagram()) {
+                slogger_net_sink_bump(m_dropped_count);
+                return;
+            }
+        }
+
+        //The site ids are valid only in this process, ship the records with the file name and fmt string inline
+        u32 expanded = expand_into_current(f_log_stream.buffer(), length);
+        if ((0U == expanded) && (0U < m_current->m_records_count)) [[unlikely]] {
+            //Does not fit, try in a new datagram
+            if (swap_current_datagram()) {
+                expanded = expand_into_current(f_log_stream.buffer(), length);
+            }
+        }
+        if (0U == expanded) [[unlikely]] {
+            slogger_net_sink_bump(m_dropped_count);
+            return;
+        }
+
+        byte* front = m_current->m_data + m_current->m_size;
+        *reinterpret_cast<slogger_net_record_len_t*>(front) = slogger_net_record_len_t(expanded);
+        m_current->m_size += u32(sizeof(slogger_net_record_len_t)) + expanded;
+        ++m_current->m_records_count;
+
+        slogger_net_sink_bump(m_records_count);
+    }
+
+    [[nodiscard]] skl_status open(const slogger_net_sink_config_t& f_config) noexcept {
+        if ((0U == f_config.m_port)
+            || (f_config.m_max_datagram_size < CSLoggerNetSinkMinDatagramSize)
+            || (f_config.m_max_datagram_size > CSLoggerNetMaxDatagramCapacity)) {
+            return SKL_ERR_PARAMS;
+        }
+
+        lock_guard_t guard{m_setup_lock};
+
+        if (m_is_open) {
+            return SKL_ERR_STATE;
+        }
+
+        m_config = f_config;
+
+        m_socket = alloc_ipv4_udp_socket();
+        if (false == is_socket_valid(m_socket)) {
+            return SKL_ERR_PORT;
+        }
+
+        void* memory = ::mmap(nullptr, CSLoggerNetSinkMemorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+        if (MAP_FAILED == memory) {
+            (void)close_socket(m_socket);
+            m_socket = CInvalidSocket;
+            return SKL_ERR_ALLOC;
+        }
+        m_datagrams = reinterpret_cast<slogger_net_sink_datagram_t*>(memory);
+
+        //All datagrams are free
+        for (u64 i = 0U; i < CSLoggerNetSinkDatagramsCount; ++i) {
+            m_datagrams[i].m_size               = 0U;
+            m_datagrams[i].m_records_count      = 0U;
+            m_free_datagrams.allocate_checked() = &m_datagrams[i];
+        }
+        m_free_datagrams.submit();
+        m_current    = nullptr;
+        m_sequence   = 0U;
+        m_last_flush = get_current_epoch_time();
+
+        {
+            lock_guard_t sink_guard{m_lock};
+            m_max_datagram_size = f_config.m_max_datagram_size;
+            m_is_open           = true;
+        }
+
+        m_running.store_release(true);
+        m_sender.set_handler([this]() noexcept -> i32 { return run_sender(); });
+        if (m_sender.create().is_failure()) {
+            m_running.store_release(false);
+            {
+                lock_guard_t sink_guard{m_lock};
+                m_is_open = false;
+            }
+            release_resources();
+            return SKL_ERR_THREAD;
+        }
+
+        return SKL_SUCCESS;
+    }
+
+    [[nodiscard]] skl_status close() noexcept {
+        lock_guard_t guard{m_setup_lock};
+
+        {
+            lock_guard_t sink_guard{m_lock};
+            if (false == m_is_open) {
+                return SKL_OK_REDUNDANT;
+            }
+            m_is_open = false;
+
+            //Hand the partially filled datagram to the sender
+            if ((nullptr != m_current) && (0U < m_current->m_records_count)) {
+                m_full_datagrams.allocate_checked() = m_current;
+                m_full_datagrams.submit();
+            }
+            m_current = nullptr;
+        }
+
+        //The sender drains all full datagrams before exiting
+        m_running.store_release(false);
+        (void)m_sender.join();
+
+        release_resources();
+
+        return SKL_SUCCESS;
+    }
+
+    [[nodiscard]] slogger_net_sink_stats_t stats() noexcept {
+        slogger_net_sink_stats_t result{};
+        {
+            lock_guard_t sink_guard{m_lock};
+            result.m_records_count = m_records_count.load_relaxed();
+            result.m_dropped_count = m_dropped_count.load_relaxed();
+        }
+        result.m_datagrams_count = m_datagrams_count.load_acquire();
+        result.m_sent_bytes      = m_sent_bytes.load_acquire();
+        result.m_send_calls      = m_send_calls.load_acquire();
+        result.m_send_errors     = m_send_errors.load_acquire();
+        return result;
+    }
+
+private:
+    //! [Locked] Expand the record after the length slot of the current datagram, records larger than the max datagram size are sent alone
+    //! \returns the expanded record length, 0 if it does not fit
+    [[nodiscard]] u32 expand_into_current(const byte* f_record, u32 f_length) noexcept {
+        const u32 limit = (0U == m_current->m_records_count) ? u32(CSLoggerNetMaxDatagramCapacity) : u32(m_max_datagram_size);
+        const u32 used  = m_current->m_size + u32(sizeof(slogger_net_record_len_t));
+        if (used >= limit) {
+            return 0U;
+        }
+        return slogger_expand_raw_record(f_record, f_length, m_current->m_data + used, limit - used);
+    }
+
+    //! [Locked] Hand the current datagram (if any records) to the sender and take a free one
+    //! \returns false if no free datagram is available
+    [[nodiscard]] bool swap_current_datagram() noexcept {
+        if ((nullptr != m_current) && (0U < m_current->m_records_count)) {
+            //There are as many full datagram slots as datagrams
+            m_full_datagrams.allocate_checked() = m_current;
+            m_full_datagrams.submit();
+            m_current = nullptr;
+        }
+
+        if (nullptr == m_current) {
+            slogger_net_sink_datagram_t** free_datagram = nullptr;
+            if (0U == m_free_datagrams.dequeue_burst(&free_datagram, 1U)) {
+                return false;
+            }
+            m_current = *free_datagram;
+            m_free_datagrams.free_processed();
+            m_current->m_size          = u32(sizeof(slogger_net_datagram_header_t));
+            m_current->m_records_count = 0U;
+        }
+
+        return true;
+    }
+
+    //! Drop all datagrams from the rings, close the socket and free the memory (no producer and no sender running)
+    void release_resources() noexcept {
+        slogger_net_sink_datagram_t** datagrams[CSLoggerNetSinkSendBatch];
+        while (0U < m_free_datagrams.dequeue_burst(datagrams, CSLoggerNetSinkSendBatch)) {
+            m_free_datagrams.free_processed();
+        }
+        while (0U < m_full_datagrams.dequeue_burst(datagrams, CSLoggerNetSinkSendBatch)) {
+            m_full_datagrams.free_processed();
+        }
+
+        (void)close_socket(m_socket);
+        m_socket = CInvalidSocket;
+
+        (void)::munmap(m_datagrams, CSLoggerNetSinkMemorySize);
+        m_datagrams = nullptr;
+    }
+
+    //! [Sender] Send the given datagrams in as few sendmmsg calls as possible
+    void send_datagrams(slogger_net_sink_datagram_t* const* f_datagrams, u32 f_count) noexcept {
+        sockaddr_in target{};
+        target.sin_family      = AF_INET;
+        target.sin_port        = le_to_be_u16(m_config.m_port);
+        target.sin_addr.s_addr = le_to_be_u32(m_config.m_address);
+
+        iovec   iov[CSLoggerNetSinkSendBatch];
+        mmsghdr messages[CSLoggerNetSinkSendBatch];
+        for (u32 i = 0U; i < f_count; ++i) {
+            auto& datagram = *f_datagrams[i];
+
+            //Stamp the header
+            auto& header           = *reinterpret_cast<slogger_net_datagram_header_t*>(datagram.m_data);
+            header.m_magic         = CSLoggerNetDatagramMagic;
+            header.m_version       = CSLoggerNetProtocolVersion;
+            header.m_records_count = u8(datagram.m_records_count);
+            header.m_sequence      = m_sequence++;
+
+            iov[i].iov_base = datagram.m_data;
+            iov[i].iov_len  = datagram.m_size;
+
+            __builtin_memset(&messages[i], 0, sizeof(mmsghdr));
+            messages[i].msg_hdr.msg_name    = &target;
+            messages[i].msg_hdr.msg_namelen = sizeof(target);
+            messages[i].msg_hdr.msg_iov     = &iov[i];
+            messages[i].msg_hdr.msg_iovlen  = 1U;
+        }
+
+        u32 sent = 0U;
+        while (sent < f_count) {
+            const i32 result = ::sendmmsg(m_socket, messages + sent, f_count - sent, 0);
+            slogger_net_sink_bump(m_send_calls);
+            if (0 > result) [[unlikely]] {
+                if (EINTR == errno) {
+                    continue;
+                }
+
+                //Skip the failing datagram
+                slogger_net_sink_bump(m_send_errors);
+                ++sent;
+                continue;
+            }
+
+            u64 bytes = 0U;
+            for (u32 i = 0U; i < u32(result); ++i) {
+                bytes += messages[sent + i].msg_len;
+            }
+            slogger_net_sink_bump(m_datagrams_count, u64(result));
+            slogger_net_sink_bump(m_sent_bytes, bytes);
+            sent += u32(result);
+        }
+    }
+
+    //! [Sender] Sender thread body
+    [[nodiscard]] i32 run_sender() noexcept {
+        slogger_net_sink_datagram_t** dequeued[CSLoggerNetSinkSendBatch];
+        slogger_net_sink_datagram_t*  datagrams[CSLoggerNetSinkSendBatch];
+
+        for (;;) {
+            const bool is_running = m_running.load_acquire();
+
+            const u32 count = m_full_datagrams.dequeue_burst(dequeued, CSLoggerNetSinkSendBatch);
+            if (0U < count) {
+                for (u32 i = 0U; i < count; ++i) {
+                    datagrams[i] = *dequeued[i];
+                }
+                m_full_datagrams.free_processed();
+
+                send_datagrams(datagrams, count);
+
+                //Give back the datagrams
+                for (u32 i = 0U; i < count; ++i) {
+                    m_free_datagrams.allocate_checked() = datagrams[i];
+                }
+                m_free_datagrams.submit();
+
+                m_last_flush = get_current_epoch_time();
+                continue;
+            }
+
+            if (false == is_running) {
+                break;
+            }
+
+            //Flush the partially filled datagram
+            const auto now = get_current_epoch_time();
+            if ((now - m_last_flush) >= m_config.m_flush_interval_ms) {
+                m_last_flush = now;
+
+                lock_guard_t sink_guard{m_lock};
+                if (m_is_open && (nullptr != m_current) && (0U < m_current->m_records_count)) {
+                    m_full_datagrams.allocate_checked() = m_current;
+                    m_full_datagrams.submit();
+                    m_current = nullptr;
+                }
+                continue;
+            }
+
+            skl_usleep(CSLoggerNetSinkSenderPollUs);
+        }
+
+        return 0;
+    }
+
+private:
+    spin_lock_t                  m_lock;                        //!< Guards the current datagram and the producer side of the datagram rings
+    spin_lock_t                  m_setup_lock;                  //!< Guards open/close
+    bool                         m_is_open           = false;   //!< [m_lock] Accepting records
+    u32                          m_max_datagram_size = 0U;      //!< [m_lock] Max datagram size
+    slogger_net_sink_datagram_t* m_current           = nullptr; //!< [m_lock] Datagram being filled
+    std::relaxed_value<u64>      m_records_count{0U};           //!< [m_lock] Records packed into datagrams
+    std::relaxed_value<u64>      m_dropped_count{0U};           //!< [m_lock] Records dropped
+    datagrams_ring_t             m_full_datagrams;              //!< {Sink -> Sender} Datagrams pending send
+    datagrams_ring_t             m_free_datagrams;              //!< {Sender -> Sink} Sent datagrams
+
+    slogger_net_sink_datagram_t* m_datagrams = nullptr; //!< All datagrams
+    slogger_net_sink_config_t    m_config{};            //!< Current config
+    socket_t                     m_socket{CInvalidSocket};
+    SKLThread                    m_sender{skl_string_view::exact_cstr("SKL SLogger Net")};
+    std::relaxed_value<bool>     m_running{false};
+
+    u32                m_sequence   = 0U; //!< [Sender] Next datagram sequence number
+    epoch_time_point_t m_last_flush = 0U; //!< [Sender] Epoch time of the last flush
+
+    std::relaxed_value<u64> m_datagrams_count{0U};
+    std::relaxed_value<u64> m_sent_bytes{0U};
+    std::relaxed_value<u64> m_send_calls{0U};
+    std::relaxed_value<u64> m_send_errors{0U};
+};
+} // namespace skl
+
+namespace {
+SKL_CACHE_ALIGNED skl::LoggerNetworkSink g_skl_net_log_sink;
+}
+
+namespace skl {
+skl_status SLoggerSinkManager::setup_network_sink(const slogger_net_sink_config_t& f_config) noexcept {
+    const auto result = g_skl_net_log_sink.open(f_config);
+    if (result.is_success()) {
+        slogger_register_sink(&g_skl_net_log_sink);
+    }
+    return result;
+}
+
+skl_status SLoggerSinkManager::close_network_sink() noexcept {
+    return g_skl_net_log_sink.close();
+}
+
+slogger_net_sink_stats_t SLoggerSinkManager::get_network_sink_stats() noexcept {
+    return g_skl_net_log_sink.stats();
+}
+} // namespace skl
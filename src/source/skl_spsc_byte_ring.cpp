@@ -0,0 +1,82 @@
+//!
+//! \file skl_spsc_byte_ring
+//!
+//! \brief Double mapped memory management of the spsc byte ring
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "skl_spsc_byte_ring"
+#include "skl_log"
+
+namespace skl {
+skl_status spsc_byte_ring_t::create(u64 f_size) noexcept {
+    if (nullptr != m_buffer) {
+        return SKL_ERR_STATE;
+    }
+
+    const long page_size = ::sysconf(_SC_PAGESIZE);
+    if ((0U == f_size) || (0U != (f_size & (f_size - 1U))) || (page_size <= 0) || (0U != (f_size % u64(page_size))) || (f_size > CMaxSize)) {
+        return SKL_ERR_PARAMS;
+    }
+
+    const int fd = ::memfd_create("skl_spsc_byte_ring", MFD_CLOEXEC);
+    if (-1 == fd) {
+        SERROR_LOCAL("spsc_byte_ring_t::create({}) memfd_create failed!", f_size);
+        return SKL_ERR_ALLOC;
+    }
+
+    if (0 != ::ftruncate(fd, off_t(f_size))) {
+        SERROR_LOCAL("spsc_byte_ring_t::create({}) ftruncate failed!", f_size);
+        (void)::close(fd);
+        return SKL_ERR_ALLOC;
+    }
+
+    // Reserve the address range of both mappings, then map the region twice over it
+    auto* base = static_cast<byte*>(::mmap(nullptr, f_size * 2U, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+    if (MAP_FAILED == static_cast<void*>(base)) {
+        SERROR_LOCAL("spsc_byte_ring_t::create({}) failed to reserve the address range!", f_size);
+        (void)::close(fd);
+        return SKL_ERR_ALLOC;
+    }
+
+    void* first  = ::mmap(base, f_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void* second = (MAP_FAILED == first) ? MAP_FAILED : ::mmap(base + f_size, f_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+
+    // The mappings keep the region alive
+    (void)::close(fd);
+
+    if ((MAP_FAILED == first) || (MAP_FAILED == second)) {
+        SERROR_LOCAL("spsc_byte_ring_t::create({}) failed to map the region twice!", f_size);
+        (void)::munmap(base, f_size * 2U);
+        return SKL_ERR_ALLOC;
+    }
+
+    m_buffer = base;
+    m_size   = f_size;
+    m_mask   = f_size - 1U;
+
+    m_write_head  = 0U;
+    m_cached_tail = 0U;
+    m_reserved    = 0U;
+    m_commit_head.store_relaxed(0U);
+    m_release_tail.store_relaxed(0U);
+    m_read_head   = 0U;
+    m_cached_head = 0U;
+
+    return SKL_SUCCESS;
+}
+
+void spsc_byte_ring_t::destroy() noexcept {
+    if (nullptr == m_buffer) {
+        return;
+    }
+
+    (void)::munmap(m_buffer, m_size * 2U);
+    m_buffer = nullptr;
+    m_size   = 0U;
+    m_mask   = 0U;
+}
+} // namespace skl
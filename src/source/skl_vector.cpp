@@ -4,6 +4,8 @@
 //! \license Licensed under the MIT License. See LICENSE for details.
 //!
 #include <cstring>
+#include <cstddef>
+#include <cstdlib>
 
 #if defined(SKL_CORE_USE_MIMALLOC)
 #    include <mimalloc.h>
@@ -13,13 +15,26 @@
 
 #include "skl_int"
 
+#if !defined(SKL_CORE_USE_MIMALLOC)
+namespace {
+//! Malloc, honors the alignments above the malloc guarantee (power of two)
+[[nodiscard]] void* skl_malloc_aligned(u64 f_bytes_count, u64 f_alignment) noexcept {
+    if (f_alignment <= alignof(std::max_align_t)) {
+        return __builtin_malloc(f_bytes_count);
+    }
+
+    void* block = nullptr;
+    return (0 == ::posix_memalign(&block, f_alignment, f_bytes_count)) ? block : nullptr;
+}
+} // namespace
+#endif
+
 namespace skl {
 void* skl_vector_alloc(u64 f_bytes_count, u64 f_alignment) noexcept {
 #if defined(SKL_CORE_USE_MIMALLOC)
     return mi_malloc_aligned(f_bytes_count, f_alignment);
 #else
-    (void)f_alignment;
-    return __builtin_malloc(f_bytes_count);
+    return skl_malloc_aligned(f_bytes_count, f_alignment);
 #endif
 }
 void skl_vector_free(void* f_block) noexcept {
@@ -34,8 +49,7 @@ void* skl_core_alloc(u64 f_bytes_count, u64 f_alignment) noexcept {
 #    if defined(SKL_CORE_USE_MIMALLOC)
     return mi_malloc_aligned(f_bytes_count, f_alignment);
 #    else
-    (void)f_alignment;
-    return __builtin_malloc(f_bytes_count);
+    return skl_malloc_aligned(f_bytes_count, f_alignment);
 #    endif
 }
 void skl_core_free(void* f_block) noexcept {
@@ -7,6 +7,8 @@
 #include <set>
 #include <chrono>
 #include <cstring>
+#include <thread>
+#include <atomic>
 
 using Pool = skl::BufferPool;
 
@@ -520,6 +522,137 @@ TEST_F(BufferPoolTest, PerformanceVsMalloc) {
     }
 }
 
+// =============================================================================
+// Multi Thread Tests
+// =============================================================================
+
+TEST_F(BufferPoolTest, CrossThreadFree) {
+    constexpr u32 CCount = 20000;
+
+    std::vector<Pool::buffer_t> buffers;
+    buffers.reserve(CCount);
+
+    std::thread producer([&]() {
+        ASSERT_TRUE(skl::skl_core_init_thread().is_success());
+        for (u32 i = 0; i < CCount; ++i) {
+            auto buffer = Pool::buffer_alloc(32 + (i % 500));
+            ASSERT_TRUE(buffer.is_valid());
+            std::memset(buffer.buffer, int(i & 0xFF), buffer.length);
+            buffers.push_back(buffer);
+        }
+        ASSERT_TRUE(skl::skl_core_deinit_thread().is_success());
+    });
+    producer.join();
+
+    std::thread consumer([&]() {
+        ASSERT_TRUE(skl::skl_core_init_thread().is_success());
+        for (u32 i = 0; i < CCount; ++i) {
+            const auto* data = reinterpret_cast<const u8*>(buffers[i].buffer);
+            ASSERT_EQ(data[0], u8(i & 0xFF));
+            ASSERT_EQ(data[buffers[i].length - 1], u8(i & 0xFF));
+            Pool::buffer_free(buffers[i].buffer);
+        }
+        ASSERT_TRUE(skl::skl_core_deinit_thread().is_success());
+    });
+    consumer.join();
+
+    //The freed buffers are reusable from any thread
+    std::set<void*> reused;
+    for (u32 i = 0; i < CCount; ++i) {
+        auto buffer = Pool::buffer_alloc(32 + (i % 500));
+        ASSERT_TRUE(buffer.is_valid());
+        ASSERT_TRUE(reused.insert(buffer.buffer).second);
+    }
+    for (void* ptr : reused) {
+        Pool::buffer_free(ptr);
+    }
+}
+
+TEST_F(BufferPoolTest, DestroyFlushesLiveThreadCaches) {
+    constexpr u32 CCount = 1000;
+
+    const u64 leaked_before = Pool::system_buffers_count();
+
+    std::atomic<u32> stage{0u};
+    std::thread      worker([&]() {
+        ASSERT_TRUE(skl::skl_core_init_thread().is_success());
+
+        // The freed buffers stay in this thread's cache
+        std::vector<void*> buffers;
+        for (u32 i = 0; i < CCount; ++i) {
+            buffers.push_back(Pool::buffer_alloc(32u << (i % 8u)).buffer);
+        }
+        for (void* buffer : buffers) {
+            Pool::buffer_free(buffer);
+        }
+
+        // Stay alive (idle) while the pool is destroyed
+        stage.store(1u, std::memory_order_release);
+        while (2u != stage.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+
+        ASSERT_TRUE(skl::skl_core_deinit_thread().is_success());
+    });
+
+    while (1u != stage.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    ASSERT_GT(Pool::system_buffers_count(), leaked_before);
+
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::system_buffers_count(), leaked_before);
+
+    stage.store(2u, std::memory_order_release);
+    worker.join();
+    ASSERT_EQ(Pool::system_buffers_count(), leaked_before);
+}
+
+TEST_F(BufferPoolTest, ConcurrentAllocFreeNoOverlap) {
+    constexpr u32 CThreadsCount = 8;
+    constexpr u32 CIterations   = 20000;
+
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < CThreadsCount; ++t) {
+        threads.emplace_back([&, t]() {
+            (void)skl::skl_core_init_thread();
+
+            std::mt19937                rng(t);
+            std::vector<Pool::buffer_t> owned;
+            for (u32 i = 0; i < CIterations; ++i) {
+                if (owned.empty() || ((rng() % 3u) != 0u && owned.size() < 512u)) {
+                    auto buffer = Pool::buffer_alloc(32u << (rng() % 6u));
+                    std::memset(buffer.buffer, int(t), buffer.length);
+                    owned.push_back(buffer);
+                } else {
+                    const size_t idx  = rng() % owned.size();
+                    const auto*  data = reinterpret_cast<const u8*>(owned[idx].buffer);
+
+                    //A buffer handed to two threads at once would be overwritten
+                    if ((data[0] != u8(t)) || (data[owned[idx].length - 1] != u8(t))) {
+                        failed.store(true);
+                    }
+                    Pool::buffer_free(owned[idx].buffer);
+                    owned[idx] = owned.back();
+                    owned.pop_back();
+                }
+            }
+            for (auto& buffer : owned) {
+                Pool::buffer_free(buffer.buffer);
+            }
+
+            (void)skl::skl_core_deinit_thread();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_FALSE(failed.load());
+}
+
 // =============================================================================
 // Allocator Tests
 // =============================================================================
@@ -0,0 +1,245 @@
+#include <skl_pool/concurrent_stable_object_pool>
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+namespace {
+std::atomic<u64> g_constructed{0u};
+std::atomic<u64> g_destructed{0u};
+} // namespace
+
+struct Object {
+    explicit Object(u64 f_value) noexcept
+        : value(f_value) {
+        g_constructed.fetch_add(1u, std::memory_order_relaxed);
+    }
+    ~Object() noexcept {
+        g_destructed.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    u64 value;
+    u64 padding[7u]{};
+};
+
+namespace {
+constexpr u64 CBlockSize = 256u;
+using pool_t             = skl::ConcurrentStableObjectPool<Object, CBlockSize>;
+} // namespace
+
+TEST(SkylakeConcurrentStableObjectPool, single_thread_basics) {
+    pool_t pool{};
+    ASSERT_EQ(pool.size(), 0u);
+    ASSERT_EQ(pool.capacity(), 0u);
+    ASSERT_FALSE(pool.owns(nullptr));
+
+    std::vector<Object*> objects;
+    for (u64 i = 0u; i < CBlockSize * 3u; ++i) {
+        auto* obj = pool.allocate(i);
+        ASSERT_NE(obj, nullptr);
+        ASSERT_TRUE(pool.owns(obj));
+        ASSERT_EQ(reinterpret_cast<u64>(obj) % alignof(Object), 0u);
+        objects.push_back(obj);
+    }
+
+    ASSERT_EQ(pool.size(), CBlockSize * 3u);
+    ASSERT_EQ(pool.blocks_count(), 3u);
+
+    for (u64 i = 0u; i < objects.size(); ++i) {
+        ASSERT_EQ(objects[i]->value, i);
+    }
+
+    Object stack_object{0u};
+    ASSERT_FALSE(pool.owns(&stack_object));
+
+    for (auto* obj : objects) {
+        pool.deallocate(obj);
+    }
+    ASSERT_EQ(pool.size(), 0u);
+
+    //Freed slots are reused, no new blocks
+    objects.clear();
+    for (u64 i = 0u; i < CBlockSize * 3u; ++i) {
+        objects.push_back(pool.allocate(i));
+    }
+    ASSERT_EQ(pool.blocks_count(), 3u);
+
+    for (auto* obj : objects) {
+        pool.deallocate(obj);
+    }
+    ASSERT_TRUE(pool.empty());
+}
+
+TEST(SkylakeConcurrentStableObjectPool, remote_frees_are_reclaimed) {
+    pool_t pool{};
+
+    std::vector<Object*> objects;
+    for (u64 i = 0u; i < CBlockSize; ++i) {
+        objects.push_back(pool.allocate(i));
+    }
+    ASSERT_EQ(pool.blocks_count(), 1u);
+
+    //Free all from another thread
+    std::thread other{[&pool, &objects]() noexcept {
+        for (auto* obj : objects) {
+            pool.deallocate(obj);
+        }
+        pool.release_thread_heap();
+    }};
+    other.join();
+    ASSERT_EQ(pool.size(), 0u);
+
+    //The owner collects the remote frees instead of allocating a new block
+    for (u64 i = 0u; i < CBlockSize; ++i) {
+        objects[i] = pool.allocate(i);
+    }
+    ASSERT_EQ(pool.blocks_count(), 1u);
+
+    for (auto* obj : objects) {
+        pool.deallocate(obj);
+    }
+}
+
+TEST(SkylakeConcurrentStableObjectPool, io_to_logic_threads) {
+    constexpr u64 CIOThreads    = 4u;
+    constexpr u64 CLogicThreads = 4u;
+    constexpr u64 CObjectsPerIO = 200'000u;
+    constexpr u64 CMaxInFlight  = 4096u;
+
+    pool_t pool{};
+
+    std::mutex           queue_lock;
+    std::vector<Object*> queue;
+    std::atomic<u64>     in_flight{0u};
+    std::atomic<u64>     consumed{0u};
+    std::atomic<bool>    bad_value{false};
+
+    std::vector<std::thread> threads;
+    for (u64 t = 0u; t < CIOThreads; ++t) {
+        threads.emplace_back([&, t]() noexcept {
+            for (u64 i = 0u; i < CObjectsPerIO; ++i) {
+                while (in_flight.load(std::memory_order_relaxed) >= CMaxInFlight) {
+                    std::this_thread::yield();
+                }
+                in_flight.fetch_add(1u, std::memory_order_relaxed);
+
+                auto* obj = pool.allocate((t << 32u) | i);
+                std::lock_guard guard{queue_lock};
+                queue.push_back(obj);
+            }
+            pool.release_thread_heap();
+        });
+    }
+
+    for (u64 t = 0u; t < CLogicThreads; ++t) {
+        threads.emplace_back([&]() noexcept {
+            std::vector<Object*> batch;
+            while (consumed.load(std::memory_order_relaxed) < CIOThreads * CObjectsPerIO) {
+                {
+                    std::lock_guard guard{queue_lock};
+                    batch.swap(queue);
+                }
+
+                for (auto* obj : batch) {
+                    if ((obj->value & 0xFFFFFFFFu) >= CObjectsPerIO) {
+                        bad_value = true;
+                    }
+                    pool.deallocate(obj);
+                }
+
+                in_flight.fetch_sub(batch.size(), std::memory_order_relaxed);
+                consumed.fetch_add(batch.size(), std::memory_order_relaxed);
+                batch.clear();
+            }
+            pool.release_thread_heap();
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_FALSE(bad_value.load());
+    ASSERT_EQ(consumed.load(), CIOThreads * CObjectsPerIO);
+    ASSERT_EQ(pool.size(), 0u);
+
+    //Remote frees are reclaimed, the pool does not grow with the count of allocations
+    //Each IO thread owns its blocks, at worst each one has all the in flight objects at some point
+    const u64 max_blocks = CIOThreads * ((CMaxInFlight / CBlockSize) + 2u);
+    ASSERT_LE(pool.blocks_count(), max_blocks);
+    (void)printf("Blocks: %lu (in flight max %lu objects)\n", pool.blocks_count(), CMaxInFlight);
+}
+
+TEST(SkylakeConcurrentStableObjectPool, abandoned_blocks_are_adopted) {
+    pool_t pool{};
+
+    std::vector<Object*> objects;
+    std::thread          first{[&pool, &objects]() noexcept {
+        for (u64 i = 0u; i < CBlockSize * 2u; ++i) {
+            objects.push_back(pool.allocate(i));
+        }
+        for (auto* obj : objects) {
+            pool.deallocate(obj);
+        }
+        pool.release_thread_heap();
+    }};
+    first.join();
+    ASSERT_EQ(pool.blocks_count(), 2u);
+
+    //Another thread adopts the abandoned blocks
+    objects.clear();
+    std::thread second{[&pool, &objects]() noexcept {
+        for (u64 i = 0u; i < CBlockSize * 2u; ++i) {
+            objects.push_back(pool.allocate(i));
+        }
+        pool.release_thread_heap();
+    }};
+    second.join();
+    ASSERT_EQ(pool.blocks_count(), 2u);
+    ASSERT_EQ(pool.size(), CBlockSize * 2u);
+
+    for (auto* obj : objects) {
+        pool.deallocate(obj);
+    }
+    ASSERT_EQ(pool.size(), 0u);
+}
+
+TEST(SkylakeConcurrentStableObjectPool, clear_destroys_live_objects) {
+    g_constructed = 0u;
+    g_destructed  = 0u;
+
+    {
+        pool_t pool{};
+
+        std::vector<Object*> objects;
+        for (u64 i = 0u; i < CBlockSize + 10u; ++i) {
+            objects.push_back(pool.allocate(i));
+        }
+
+        //Some freed locally, some remotely
+        for (u64 i = 0u; i < 20u; ++i) {
+            pool.deallocate(objects[i]);
+        }
+        std::thread other{[&pool, &objects]() noexcept {
+            for (u64 i = 20u; i < 40u; ++i) {
+                pool.deallocate(objects[i]);
+            }
+        }};
+        other.join();
+
+        ASSERT_EQ(g_destructed.load(), 40u);
+        ASSERT_EQ(pool.size(), CBlockSize + 10u - 40u);
+
+        pool.clear();
+        ASSERT_EQ(g_destructed.load(), CBlockSize + 10u);
+        ASSERT_EQ(pool.blocks_count(), 0u);
+
+        //Usable after clear
+        auto* obj = pool.allocate(5u);
+        ASSERT_EQ(obj->value, 5u);
+    }
+
+    ASSERT_EQ(g_constructed.load(), g_destructed.load());
+}
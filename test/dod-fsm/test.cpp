@@ -1,3 +1,8 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <skl_core>
 #include <skl_dod_fsm>
 
 #include <gtest/gtest.h>
@@ -160,6 +165,172 @@ ETestStates tick_state<ETestStates::Dead>(test_toolkit_t::state_instance_t<dead_
 
 } // namespace skl::dod_fsm
 
+// Sleeping (yield_for) test FSM, small wheel (4 x 10ms) so long sleeps go around it
+enum class ESleepTestStates : u32 {
+    None = 0,
+    Napping,
+};
+
+constexpr skl::dod_fsm::SklDoDFsmToolkitSettings CSleepTestSettings{
+    .default_accumulate_realtime_time = false,
+    .invalid_entity_id                = 0u,
+    .sleep_wheel_granularity_ms       = 10u,
+    .sleep_wheel_slots_count          = 4u,
+};
+
+using sleep_test_toolkit_t = skl::dod_fsm::SklDoDFsmToolkit<ESleepTestStates, CSleepTestSettings>;
+
+struct napping_state_t {
+    static constexpr ESleepTestStates CState = ESleepTestStates::Napping;
+
+    struct transition_data_t {
+        float nap_ms;
+        u32   naps;
+    };
+
+    napping_state_t() = default;
+    explicit napping_state_t(const transition_data_t& f_trans) : nap_ms(f_trans.nap_ms), naps_left(f_trans.naps), ticks(0u) {}
+
+    float nap_ms;
+    u32   naps_left;
+    u32   ticks;
+};
+
+using sleep_test_fsm_t = sleep_test_toolkit_t::FSM<2, napping_state_t>;
+
+namespace skl::dod_fsm {
+template <>
+ESleepTestStates tick_state<ESleepTestStates::Napping>(sleep_test_toolkit_t::state_instance_t<napping_state_t>& f_state_instance, float, float) noexcept {
+    auto& data = f_state_instance.data;
+    ++data.ticks;
+
+    if (0u < data.naps_left) {
+        --data.naps_left;
+        sleep_test_fsm_t::yield_for(data.nap_ms);
+    }
+
+    return ESleepTestStates::Napping;
+}
+} // namespace skl::dod_fsm
+
+// Parallel tick test FSM, handlers only depend on their own data (not on dt) so runs can be compared
+enum class EParallelTestStates : u32 {
+    None = 0,
+    Wander,
+    Fight,
+    Rest,
+};
+
+constexpr skl::dod_fsm::SklDoDFsmToolkitSettings CParallelTestSettings{
+    .default_accumulate_realtime_time = false,
+    .invalid_entity_id                = 0u,
+    .parallel_min_chunk_size          = 64u,
+};
+
+using parallel_test_toolkit_t = skl::dod_fsm::SklDoDFsmToolkit<EParallelTestStates, CParallelTestSettings>;
+
+struct wander_state_t {
+    static constexpr EParallelTestStates CState = EParallelTestStates::Wander;
+
+    struct transition_data_t {
+        u32 seed;
+    };
+
+    wander_state_t() = default;
+    explicit wander_state_t(const transition_data_t& f_trans) : seed(f_trans.seed), steps(0u) {}
+
+    u32 seed;
+    u32 steps;
+};
+
+struct fight_state_t {
+    static constexpr EParallelTestStates CState = EParallelTestStates::Fight;
+
+    struct transition_data_t {
+        u32 target_id;
+    };
+
+    fight_state_t() = default;
+    explicit fight_state_t(const transition_data_t& f_trans) : target_id(f_trans.target_id), rounds(0u) {}
+
+    u32 target_id;
+    u32 rounds;
+};
+
+struct rest_state_t {
+    static constexpr EParallelTestStates CState = EParallelTestStates::Rest;
+
+    struct transition_data_t {
+        u32 ticks;
+    };
+
+    rest_state_t() = default;
+    explicit rest_state_t(const transition_data_t& f_trans) : ticks_left(f_trans.ticks) {}
+
+    u32 ticks_left;
+};
+
+using parallel_test_fsm_t = parallel_test_toolkit_t::FSM<3, wander_state_t, fight_state_t, rest_state_t>;
+
+[[nodiscard]] constexpr u32 parallel_test_hash(u32 f_a, u32 f_b) noexcept {
+    u32 h = (f_a * 2654435761u) ^ (f_b * 2246822519u);
+    h ^= h >> 15u;
+    h *= 2246822519u;
+    h ^= h >> 13u;
+    return h;
+}
+
+namespace skl::dod_fsm {
+template <>
+EParallelTestStates tick_state<EParallelTestStates::Wander>(parallel_test_toolkit_t::state_instance_t<wander_state_t>& f_state_instance, float, float) noexcept {
+    auto&     data = f_state_instance.data;
+    const u32 hash = parallel_test_hash(f_state_instance.header.id + data.seed, ++data.steps);
+
+    if (0u == (hash % 97u)) {
+        // Kill a neighbour
+        parallel_test_fsm_t::remove_entity(f_state_instance.header.id + 1u);
+    }
+
+    if (0u == (hash % 7u)) {
+        parallel_test_fsm_t::enqueue_transition<fight_state_t>(f_state_instance.header.id, {.target_id = f_state_instance.header.id ^ 1u});
+        return EParallelTestStates::Fight;
+    }
+
+    if (0u == (hash % 211u)) {
+        // Despawn (no transition)
+        return EParallelTestStates::None;
+    }
+
+    return EParallelTestStates::Wander;
+}
+
+template <>
+EParallelTestStates tick_state<EParallelTestStates::Fight>(parallel_test_toolkit_t::state_instance_t<fight_state_t>& f_state_instance, float, float) noexcept {
+    auto& data = f_state_instance.data;
+    if (++data.rounds >= (1u + (data.target_id % 5u))) {
+        parallel_test_fsm_t::enqueue_transition<rest_state_t>(f_state_instance.header.id, {.ticks = f_state_instance.header.id % 3u});
+        return EParallelTestStates::Rest;
+    }
+    return EParallelTestStates::Fight;
+}
+
+template <>
+EParallelTestStates tick_state<EParallelTestStates::Rest>(parallel_test_toolkit_t::state_instance_t<rest_state_t>& f_state_instance, float, float) noexcept {
+    auto& data = f_state_instance.data;
+    if (0u == (f_state_instance.header.id % 31u)) {
+        // Sleeps for the whole test
+        parallel_test_fsm_t::yield_for(1000000.0f);
+        return EParallelTestStates::Rest;
+    }
+
+    if (0u == data.ticks_left--) {
+        parallel_test_fsm_t::enqueue_transition<wander_state_t>(f_state_instance.header.id, {.seed = f_state_instance.header.id * 3u});
+        return EParallelTestStates::Wander;
+    }
+    return EParallelTestStates::Rest;
+}
+} // namespace skl::dod_fsm
+
 // [TestUtil] Test fixture
 class skylake_dod_fsm_test_t : public ::testing::Test {
 protected:
@@ -389,3 +560,292 @@ TEST_F(skylake_dod_fsm_test_t, avx512_batch_processing) {
         EXPECT_GT(instance.header.accumulated_time_ms, 0.0f);
     }
 }
+
+TEST_F(skylake_dod_fsm_test_t, sparse_index_pages) {
+    // [TestUtil] [DOD] Ids far apart only allocate their own pages
+    constexpr u32 CPageSize = skl::dod_fsm::sparse_entity_index_t::CPageSize;
+    const u32     ids[]     = {1u, CPageSize + 5u, (CPageSize * 64u) + 7u};
+
+    for (const u32 id : ids) {
+        idle_state_t::transition_data_t trans_data{.initial_delay = 1000.0f};
+        test_fsm_t::enqueue_transition<idle_state_t>(id, std::move(trans_data));
+    }
+    test_fsm_t::tick();
+
+    for (const u32 id : ids) {
+        EXPECT_EQ(test_fsm_t::get_entity_state(id), ETestStates::Idle);
+    }
+    EXPECT_EQ(test_fsm_t::get_entity_state(CPageSize * 32u), static_cast<ETestStates>(0));
+    EXPECT_GE(test_fsm_t::get_entity_index().pages_count(), 3u);
+}
+
+TEST_F(skylake_dod_fsm_test_t, removal_bumps_generation) {
+    // [TestUtil] [DOD] Removal requests only apply to the entity generation they were made for
+    const u32 entity_id = 7;
+    test_fsm_t::enqueue_transition<idle_state_t>(entity_id, {.initial_delay = 1000.0f});
+    test_fsm_t::tick();
+
+    const auto* entry = test_fsm_t::get_entity_index().find(entity_id);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->generation, 0u);
+    EXPECT_TRUE(entry->is_placed());
+
+    // Two requests for the same generation remove the entity once
+    test_fsm_t::remove_entity(entity_id);
+    test_fsm_t::remove_entity(entity_id);
+    test_fsm_t::tick();
+    EXPECT_EQ(entry->generation, 1u);
+    EXPECT_FALSE(entry->is_alive());
+    EXPECT_EQ(test_fsm_t::get_state_instances_vector<idle_state_t>().size(), 0u);
+
+    // Removing an unknown entity does nothing
+    test_fsm_t::remove_entity(entity_id);
+    test_fsm_t::tick();
+    EXPECT_EQ(entry->generation, 1u);
+
+    // Re-add
+    test_fsm_t::enqueue_transition<idle_state_t>(entity_id, {.initial_delay = 1000.0f});
+    test_fsm_t::tick();
+    EXPECT_EQ(entry->generation, 1u);
+    EXPECT_EQ(test_fsm_t::get_entity_state(entity_id), ETestStates::Idle);
+    EXPECT_EQ(test_fsm_t::get_state_instances_vector<idle_state_t>().size(), 1u);
+}
+
+TEST_F(skylake_dod_fsm_test_t, remove_entity_in_transition) {
+    // [TestUtil] [DOD] Removal of an entity that is not placed yet is routed to its target state
+    const u32 entity_id = 3;
+    test_fsm_t::enqueue_transition<moving_state_t>(entity_id, {.speed = 1.0f, .target_x = 10.0f, .target_y = 10.0f});
+    EXPECT_EQ(test_fsm_t::get_entity_state(entity_id), static_cast<ETestStates>(0));
+
+    test_fsm_t::remove_entity(entity_id);
+    test_fsm_t::tick();
+
+    EXPECT_EQ(test_fsm_t::get_entity_state(entity_id), static_cast<ETestStates>(0));
+    EXPECT_EQ(test_fsm_t::get_state_instances_vector<moving_state_t>().size(), 0u);
+}
+
+// [TestUtil] Sleep test fixture
+class skylake_dod_fsm_sleep_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        sleep_test_fsm_t::clear();
+        sleep_test_fsm_t::reset_timer();
+    }
+};
+
+TEST_F(skylake_dod_fsm_sleep_test_t, yield_for_skips_ticks) {
+    // [TestUtil] [DOD] A sleeping instance is moved out of the instances vector until it is due
+    const u32 entity_id = 1;
+    sleep_test_fsm_t::enqueue_transition<napping_state_t>(entity_id, {.nap_ms = 50.0f, .naps = 1u});
+    sleep_test_fsm_t::tick();
+
+    auto& instances = sleep_test_fsm_t::get_state_instances_vector<napping_state_t>();
+    EXPECT_EQ(instances.size(), 0u);
+    EXPECT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 1u);
+    EXPECT_EQ(sleep_test_fsm_t::get_entity_state(entity_id), ESleepTestStates::Napping);
+    EXPECT_TRUE(sleep_test_fsm_t::get_entity_index().find(entity_id)->is_sleeping());
+
+    // Not due yet
+    sleep_test_fsm_t::tick();
+    EXPECT_EQ(instances.size(), 0u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sleep_test_fsm_t::tick();
+
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].data.ticks, 2u);
+    EXPECT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 0u);
+    EXPECT_FALSE(sleep_test_fsm_t::get_entity_index().find(entity_id)->is_sleeping());
+
+    // No more naps, ticked every tick
+    sleep_test_fsm_t::tick();
+    EXPECT_EQ(instances[0].data.ticks, 3u);
+}
+
+TEST_F(skylake_dod_fsm_sleep_test_t, only_awake_instances_are_ticked) {
+    // [TestUtil] [DOD] Sleeping and awake instances in the same state, swap and pop keeps the index in sync
+    for (u32 i = 1; i <= 20; ++i) {
+        sleep_test_fsm_t::enqueue_transition<napping_state_t>(i, {.nap_ms = 1000.0f, .naps = (i % 2u)});
+    }
+    sleep_test_fsm_t::tick();
+    sleep_test_fsm_t::tick();
+
+    auto& instances = sleep_test_fsm_t::get_state_instances_vector<napping_state_t>();
+    ASSERT_EQ(instances.size(), 10u);
+    EXPECT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 10u);
+
+    for (u32 slot = 0u; slot < instances.size(); ++slot) {
+        const auto& instance = instances[slot];
+        EXPECT_EQ(instance.header.id % 2u, 0u);
+        EXPECT_EQ(instance.data.ticks, 2u);
+        EXPECT_EQ(sleep_test_fsm_t::get_entity_index().find(instance.header.id)->slot, slot);
+    }
+
+    for (u32 i = 1; i <= 20; ++i) {
+        EXPECT_EQ(sleep_test_fsm_t::get_entity_state(i), ESleepTestStates::Napping);
+    }
+}
+
+TEST_F(skylake_dod_fsm_sleep_test_t, remove_sleeping_entity) {
+    // [TestUtil] [DOD] A sleeping entity can be removed, its sleep record is dropped on wake up
+    const u32 entity_id = 5;
+    sleep_test_fsm_t::enqueue_transition<napping_state_t>(entity_id, {.nap_ms = 20.0f, .naps = 1u});
+    sleep_test_fsm_t::tick();
+    ASSERT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 1u);
+
+    sleep_test_fsm_t::remove_entity(entity_id);
+    sleep_test_fsm_t::tick();
+    EXPECT_EQ(sleep_test_fsm_t::get_entity_state(entity_id), ESleepTestStates::None);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    sleep_test_fsm_t::tick();
+
+    EXPECT_EQ(sleep_test_fsm_t::get_state_instances_vector<napping_state_t>().size(), 0u);
+    EXPECT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 0u);
+    EXPECT_EQ(sleep_test_fsm_t::get_entity_state(entity_id), ESleepTestStates::None);
+}
+
+TEST_F(skylake_dod_fsm_sleep_test_t, long_sleep_goes_around_the_wheel) {
+    // [TestUtil] [DOD] Sleeps longer than the wheel (40ms) are put back until due
+    const u32 entity_id = 9;
+    sleep_test_fsm_t::enqueue_transition<napping_state_t>(entity_id, {.nap_ms = 250.0f, .naps = 1u});
+    sleep_test_fsm_t::tick();
+
+    auto& instances = sleep_test_fsm_t::get_state_instances_vector<napping_state_t>();
+    for (u32 i = 0u; i < 6u; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(15));
+        sleep_test_fsm_t::tick();
+    }
+    EXPECT_EQ(instances.size(), 0u);
+    EXPECT_EQ(sleep_test_fsm_t::get_sleeping_count<napping_state_t>(), 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    sleep_test_fsm_t::tick();
+    ASSERT_EQ(instances.size(), 1u);
+    EXPECT_EQ(instances[0].data.ticks, 2u);
+}
+
+// [TestUtil] Parallel tick snapshot (everything but the accumulated times, which depend on the wall clock)
+struct parallel_test_snapshot_t {
+    std::vector<u32>                                         wander;
+    std::vector<u32>                                         fight;
+    std::vector<u32>                                         rest;
+    std::vector<skl::dod_fsm::sparse_entity_index_t::entry_t> entries;
+    u64                                                      sleeping;
+
+    static parallel_test_snapshot_t take(u32 f_max_id) noexcept {
+        parallel_test_snapshot_t result{};
+        for (const auto& instance : parallel_test_fsm_t::get_state_instances_vector<wander_state_t>()) {
+            result.wander.insert(result.wander.end(), {instance.header.id, instance.data.seed, instance.data.steps});
+        }
+        for (const auto& instance : parallel_test_fsm_t::get_state_instances_vector<fight_state_t>()) {
+            result.fight.insert(result.fight.end(), {instance.header.id, instance.data.target_id, instance.data.rounds});
+        }
+        for (const auto& instance : parallel_test_fsm_t::get_state_instances_vector<rest_state_t>()) {
+            result.rest.insert(result.rest.end(), {instance.header.id, instance.data.ticks_left});
+        }
+        for (u32 id = 1u; id <= f_max_id; ++id) {
+            result.entries.push_back(*parallel_test_fsm_t::get_entity_index().find(id));
+        }
+        result.sleeping = parallel_test_fsm_t::get_sleeping_count<rest_state_t>();
+        return result;
+    }
+};
+
+class skylake_dod_fsm_parallel_test_t : public ::testing::Test {
+protected:
+    static constexpr u32 CEntities = 5000u;
+    static constexpr u32 CTicks    = 60u;
+
+    void SetUp() override {
+        ASSERT_TRUE(skl::skl_core_init().is_success());
+    }
+
+    static void spawn() noexcept {
+        parallel_test_fsm_t::clear();
+        parallel_test_fsm_t::reset_timer();
+        for (u32 id = 1u; id <= CEntities; ++id) {
+            parallel_test_fsm_t::enqueue_transition<wander_state_t>(id, {.seed = id});
+        }
+    }
+};
+
+TEST_F(skylake_dod_fsm_parallel_test_t, identical_to_serial_tick) {
+    // [TestUtil] [DOD] The parallel tick gives the exact same instances order, data and entity index as the serial tick
+    spawn();
+    for (u32 i = 0u; i < CTicks; ++i) {
+        parallel_test_fsm_t::tick();
+    }
+    const auto serial = parallel_test_snapshot_t::take(CEntities + 1u);
+
+    skl::dod_fsm::tick_worker_pool_t pool;
+    ASSERT_TRUE(pool.create(4u).is_success());
+    ASSERT_EQ(pool.workers_count(), 4u);
+
+    spawn();
+    for (u32 i = 0u; i < CTicks; ++i) {
+        parallel_test_fsm_t::tick_parallel(pool);
+    }
+    const auto parallel = parallel_test_snapshot_t::take(CEntities + 1u);
+
+    pool.destroy();
+
+    // The workload exercised transitions, removals, despawns and sleeps
+    EXPECT_FALSE(serial.fight.empty());
+    EXPECT_FALSE(serial.rest.empty());
+    EXPECT_GT(serial.sleeping, 0u);
+    EXPECT_LT(serial.wander.size() + serial.fight.size() + serial.rest.size(), CEntities * 3u);
+
+    EXPECT_EQ(serial.wander, parallel.wander);
+    EXPECT_EQ(serial.fight, parallel.fight);
+    EXPECT_EQ(serial.rest, parallel.rest);
+    EXPECT_EQ(serial.sleeping, parallel.sleeping);
+    ASSERT_EQ(serial.entries.size(), parallel.entries.size());
+    for (u64 i = 0u; i < serial.entries.size(); ++i) {
+        EXPECT_EQ(serial.entries[i].slot, parallel.entries[i].slot) << "id " << (i + 1u);
+        EXPECT_EQ(serial.entries[i].generation, parallel.entries[i].generation) << "id " << (i + 1u);
+        EXPECT_EQ(serial.entries[i].state_index, parallel.entries[i].state_index) << "id " << (i + 1u);
+    }
+}
+
+TEST_F(skylake_dod_fsm_parallel_test_t, single_worker_pool) {
+    // [TestUtil] A pool without worker threads ticks on the calling thread
+    skl::dod_fsm::tick_worker_pool_t pool;
+    ASSERT_TRUE(pool.create(1u).is_success());
+    EXPECT_EQ(pool.workers_count(), 1u);
+    EXPECT_EQ(pool.create(1u), SKL_ERR_STATE);
+
+    spawn();
+    parallel_test_fsm_t::tick();
+    const auto serial = parallel_test_snapshot_t::take(CEntities);
+
+    spawn();
+    parallel_test_fsm_t::tick_parallel(pool);
+    const auto parallel = parallel_test_snapshot_t::take(CEntities);
+
+    EXPECT_FALSE(parallel.wander.empty());
+    EXPECT_EQ(serial.wander, parallel.wander);
+    EXPECT_EQ(serial.fight, parallel.fight);
+}
+
+TEST_F(skylake_dod_fsm_parallel_test_t, pool_caller_parks_on_slow_workers) {
+    // [TestUtil] The workers outlast the caller's spins, run() parks and is woken by the last worker
+    skl::dod_fsm::tick_worker_pool_t pool;
+    ASSERT_TRUE(pool.create(3u, false).is_success());
+
+    std::atomic<u32> ran{0u};
+    for (u32 i = 0u; i < 5u; ++i) {
+        pool.run([](void* f_context, u32 f_worker_index) noexcept {
+            if (0u != f_worker_index) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+            static_cast<std::atomic<u32>*>(f_context)->fetch_add(1u, std::memory_order_relaxed);
+        }, &ran);
+        ASSERT_EQ(ran.load(), (i + 1u) * 3u);
+
+        // Let the workers park between the runs
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    pool.destroy();
+}
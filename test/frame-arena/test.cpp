@@ -0,0 +1,225 @@
+#include <skl_frame_arena>
+#include <skl_vector_if>
+#include <skl_fixed_vector_if>
+#include <skl_report>
+#include <skl_report_read>
+#include <skl_stream>
+#include <skl_core>
+#include <skl_huge_pages>
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+constexpr u64 CArenaSize = 1024ULL * 1024ULL;
+} // namespace
+
+TEST(SkylakeFrameArena, BumpAndAlignment) {
+    skl::frame_arena_t arena{};
+    ASSERT_FALSE(arena.is_valid());
+    ASSERT_EQ(nullptr, arena.allocate(8U));
+
+    ASSERT_EQ(SKL_ERR_PARAMS, arena.create(0U, false));
+    ASSERT_TRUE(arena.create(CArenaSize, false).is_success());
+    ASSERT_EQ(SKL_ERR_STATE, arena.create(CArenaSize, false));
+    ASSERT_TRUE(arena.is_valid());
+    ASSERT_EQ(CArenaSize, arena.capacity());
+    ASSERT_EQ(0U, arena.used());
+
+    auto* first = static_cast<byte*>(arena.allocate(3U, 1U));
+    ASSERT_NE(nullptr, first);
+
+    auto* aligned = static_cast<byte*>(arena.allocate(64U, 64U));
+    ASSERT_NE(nullptr, aligned);
+    ASSERT_EQ(0U, reinterpret_cast<u64>(aligned) % 64U);
+    ASSERT_GE(aligned, first + 3U);
+
+    auto* values = arena.allocate_array<u64>(16U);
+    ASSERT_NE(nullptr, values);
+    ASSERT_EQ(0U, reinterpret_cast<u64>(values) % alignof(u64));
+    for (u64 i = 0U; i < 16U; ++i) {
+        values[i] = i;
+    }
+
+    //Does not fit
+    const auto used = arena.used();
+    ASSERT_EQ(nullptr, arena.allocate(arena.remaining() + 1U, 1U));
+    ASSERT_EQ(used, arena.used());
+    ASSERT_EQ(1U, arena.report().m_failed_allocations);
+
+    //Exactly fits
+    ASSERT_NE(nullptr, arena.allocate(arena.remaining(), 1U));
+    ASSERT_EQ(0U, arena.remaining());
+
+    arena.destroy();
+    ASSERT_FALSE(arena.is_valid());
+}
+
+TEST(SkylakeFrameArena, MarksAndReset) {
+    skl::frame_arena_t arena{};
+    ASSERT_TRUE(arena.create(CArenaSize, false).is_success());
+
+    (void)arena.allocate(100U);
+    const auto outer = arena.mark();
+    const auto base  = arena.used();
+
+    (void)arena.allocate(1000U);
+    {
+        skl::frame_arena_scope_t scope{arena};
+        (void)arena.allocate(5000U);
+        ASSERT_GE(arena.used(), base + 6000U);
+    }
+    ASSERT_GE(arena.used(), base + 1000U);
+    ASSERT_LT(arena.used(), base + 6000U);
+
+    arena.rewind(outer);
+    ASSERT_EQ(base, arena.used());
+
+    //The high water mark keeps the peak of the frame
+    ASSERT_GE(arena.high_water_mark(), base + 6000U);
+
+    arena.reset();
+    ASSERT_EQ(0U, arena.used());
+    ASSERT_EQ(base, arena.report().m_last_frame_used);
+    ASSERT_EQ(1U, arena.report().m_frames_count);
+
+    //A bigger frame raises the high water mark
+    (void)arena.allocate(100000U);
+    ASSERT_GE(arena.high_water_mark(), 100000U);
+    arena.reset();
+
+    const auto report = arena.report();
+    ASSERT_EQ(CArenaSize, report.m_capacity);
+    ASSERT_EQ(0U, report.m_used);
+    ASSERT_GE(report.m_high_water_mark, 100000U);
+    ASSERT_GE(report.m_last_frame_used, 100000U);
+    ASSERT_EQ(2U, report.m_frames_count);
+    ASSERT_EQ(0U, report.m_failed_allocations);
+}
+
+TEST(SkylakeFrameArena, ThreadArenaContainers) {
+    ASSERT_FALSE(skl::skl_frame_arena_is_thread_init());
+    ASSERT_TRUE(skl::skl_frame_arena_thread_init(CArenaSize, false).is_success());
+    ASSERT_EQ(SKL_OK_REDUNDANT, skl::skl_frame_arena_thread_init(CArenaSize, false));
+    ASSERT_TRUE(skl::skl_frame_arena_is_thread_init());
+
+    auto& arena = skl::skl_frame_arena();
+
+    for (u32 frame = 0U; frame < 3U; ++frame) {
+        {
+            skl::skl_frame_vector<u32> vector{};
+            for (u32 i = 0U; i < 1000U; ++i) {
+                vector.upgrade().push_back(i);
+            }
+            ASSERT_EQ(1000U, vector.size());
+            for (u32 i = 0U; i < 1000U; ++i) {
+                ASSERT_EQ(i, vector[i]);
+            }
+
+            ASSERT_GE(arena.used(), vector.capacity() * sizeof(u32));
+
+            skl::skl_frame_fixed_vector<u64, 256U> fixed{};
+            for (u64 i = 0U; i < 256U; ++i) {
+                ASSERT_TRUE(fixed.upgrade().push_back_safe(i));
+            }
+            ASSERT_FALSE(fixed.upgrade().push_back_safe(0U));
+
+            std::vector<u64, skl::frame_allocator<u64>> std_vector{};
+            for (u64 i = 0U; i < 1000U; ++i) {
+                std_vector.push_back(i * 2U);
+            }
+            ASSERT_EQ(1998U, std_vector.back());
+        }
+
+        ASSERT_GT(arena.used(), 0U);
+        arena.reset();
+        ASSERT_EQ(0U, arena.used());
+    }
+
+    ASSERT_EQ(3U, arena.report().m_frames_count);
+    ASSERT_GT(arena.high_water_mark(), 1000U * sizeof(u32));
+
+    skl::skl_frame_arena_thread_deinit();
+    ASSERT_FALSE(skl::skl_frame_arena_is_thread_init());
+}
+
+TEST(SkylakeFrameArena, ExhaustedArenaFallsBackToHeap) {
+    // Containers outgrowing the arena keep working, the blocks that do not fit come from the core allocator
+    constexpr u64 CSmallArenaSize = 4096U;
+    ASSERT_TRUE(skl::skl_frame_arena_thread_init(CSmallArenaSize, false).is_success());
+
+    auto& arena = skl::skl_frame_arena();
+    {
+        skl::skl_frame_vector<u64> vector{};
+        for (u64 i = 0U; i < 4096U; ++i) {
+            vector.upgrade().push_back(i);
+        }
+        for (u64 i = 0U; i < 4096U; ++i) {
+            ASSERT_EQ(i, vector[i]);
+        }
+        ASSERT_FALSE(arena.owns(vector.data()));
+
+        std::vector<u64, skl::frame_allocator<u64>> std_vector{};
+        for (u64 i = 0U; i < 4096U; ++i) {
+            std_vector.push_back(i);
+        }
+        ASSERT_EQ(4095U, std_vector.back());
+        ASSERT_FALSE(arena.owns(std_vector.data()));
+
+        // The heap blocks are not touched by the reset, the arena serves again
+        arena.reset();
+        auto* small = arena.allocate(16U);
+        ASSERT_NE(nullptr, small);
+        ASSERT_TRUE(arena.owns(small));
+    }
+
+    ASSERT_GT(arena.report().m_failed_allocations, 0U);
+    ASSERT_EQ(1U, arena.report().m_frames_count);
+
+    skl::skl_frame_arena_thread_deinit();
+}
+
+TEST(SkylakeFrameArena, Report) {
+    skl::frame_arena_t arena{};
+    ASSERT_TRUE(arena.create(CArenaSize, false).is_success());
+    (void)arena.allocate(4096U);
+    arena.reset();
+
+    auto& stream = skl::skl_report_begin();
+    ASSERT_TRUE(arena.write_report(stream));
+    skl::skl_report_submit();
+
+    const auto reports_count = skl::skl_report_read_begin();
+    ASSERT_EQ(1U, reports_count);
+
+    auto& read_stream = skl::skl_report_read_current_begin();
+    read_stream.reset();
+    skl::frame_arena_report_t report{};
+    __builtin_memcpy(&report, read_stream.front(), sizeof(report));
+    skl::skl_report_read_current_end();
+    skl::skl_report_read_end();
+
+    ASSERT_EQ(CArenaSize, report.m_capacity);
+    ASSERT_EQ(4096U, report.m_high_water_mark);
+    ASSERT_EQ(4096U, report.m_last_frame_used);
+    ASSERT_EQ(1U, report.m_frames_count);
+    ASSERT_EQ(0U, report.m_is_huge_pages);
+}
+
+TEST(SkylakeFrameArena, HugePagesBacked) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+    if (false == skl::huge_pages::is_huge_pages_enabled()) {
+        ASSERT_TRUE(skl::skl_core_deinit().is_success());
+        GTEST_SKIP() << "Huge pages are not available";
+    }
+
+    skl::frame_arena_t arena{};
+    ASSERT_TRUE(arena.create(1024U, true).is_success());
+    ASSERT_TRUE(arena.is_huge_pages());
+    ASSERT_EQ(skl::huge_pages::CHugePageSize, arena.capacity());
+    ASSERT_NE(nullptr, arena.allocate(arena.capacity(), 1U));
+    arena.destroy();
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
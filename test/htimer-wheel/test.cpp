@@ -0,0 +1,373 @@
+#include <skl_core>
+#include <skl_rand>
+#include <skl_timing/htimer_wheel>
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <memory>
+
+namespace {
+using handle_t      = skl::htimer_wheel::handle_t;
+using small_wheel_t = skl::HierarchicalWheel<4u, 2u, 3u>; // 16 + 4 + 4 slots, 256 ticks range
+using wheel_t       = skl::HierarchicalWheel<>;
+
+static_assert(small_wheel_t::CMaxDelayTicks == 255u);
+static_assert(wheel_t::CMaxDelayTicks == 0xFFFFFFFFu);
+
+//! Advance the wheel one tick at a time and check each entry expires exactly on its tick
+template <typename _Wheel>
+void expect_exact_expiry(_Wheel& f_wheel, const std::vector<u64>& f_expiry, u64 f_last_tick) {
+    u64  expired_count = 0u;
+    u64  current_tick  = 0u;
+    bool all_on_time   = true;
+
+    auto on_expired = [&](handle_t f_handle) noexcept {
+        const auto index = skl::htimer_wheel::handle_index(f_handle);
+        all_on_time &= (f_expiry[index] == current_tick);
+        ++expired_count;
+    };
+
+    for (current_tick = f_wheel.now(); current_tick <= f_last_tick; ++current_tick) {
+        (void)f_wheel.advance(current_tick, on_expired);
+    }
+
+    ASSERT_TRUE(all_on_time);
+    ASSERT_EQ(expired_count, f_expiry.size());
+    ASSERT_TRUE(f_wheel.empty());
+}
+} // namespace
+
+TEST(SkylakeHTimerWheel, handle_encoding) {
+    const auto handle = skl::htimer_wheel::make_handle(7u, 3u);
+    ASSERT_EQ(skl::htimer_wheel::handle_index(handle), 7u);
+    ASSERT_EQ(skl::htimer_wheel::handle_generation(handle), 3u);
+    ASSERT_NE(handle, skl::htimer_wheel::CInvalidHandle);
+}
+
+TEST(SkylakeHTimerWheel, levels_placement) {
+    small_wheel_t wheel{};
+
+    const auto h0 = skl::htimer_wheel::make_handle(0u, 1u);
+    const auto h1 = skl::htimer_wheel::make_handle(1u, 1u);
+    const auto h2 = skl::htimer_wheel::make_handle(2u, 1u);
+    const auto h3 = skl::htimer_wheel::make_handle(3u, 1u);
+
+    wheel.insert(h0, 15u);
+    wheel.insert(h1, 16u);
+    wheel.insert(h2, 64u);
+    wheel.insert(h3, 10'000u);
+
+    ASSERT_EQ(wheel.level_of(h0), 0u);
+    ASSERT_EQ(wheel.level_of(h1), 1u);
+    ASSERT_EQ(wheel.level_of(h2), 2u);
+    ASSERT_EQ(wheel.level_of(h3), 2u); //Beyond range, parked on the last level
+    ASSERT_EQ(wheel.size(), 4u);
+
+    expect_exact_expiry(wheel, {15u, 16u, 64u, 10'000u}, 10'000u);
+}
+
+TEST(SkylakeHTimerWheel, cascade_exact_expiry) {
+    skl::SklRand rand{};
+
+    {
+        small_wheel_t    wheel{};
+        std::vector<u64> expiry;
+        for (u32 i = 0u; i < 20'000u; ++i) {
+            expiry.push_back(rand.next_range(0u, 2000u));
+            wheel.insert(skl::htimer_wheel::make_handle(i, 1u), expiry.back());
+        }
+        expect_exact_expiry(wheel, expiry, 2000u);
+    }
+
+    {
+        wheel_t          wheel{};
+        std::vector<u64> expiry;
+        for (u32 i = 0u; i < 50'000u; ++i) {
+            expiry.push_back(rand.next_range(0u, 1u << 20u));
+            wheel.insert(skl::htimer_wheel::make_handle(i, 1u), expiry.back());
+        }
+        expect_exact_expiry(wheel, expiry, 1u << 20u);
+    }
+}
+
+TEST(SkylakeHTimerWheel, insert_while_advancing) {
+    small_wheel_t    wheel{};
+    std::vector<u64> expiry;
+
+    u64  current_tick = 0u;
+    u64  expired      = 0u;
+    bool all_on_time  = true;
+
+    auto on_expired = [&](handle_t f_handle) noexcept {
+        all_on_time &= (expiry[skl::htimer_wheel::handle_index(f_handle)] == current_tick);
+        ++expired;
+    };
+
+    skl::SklRand rand{};
+    for (current_tick = 0u; current_tick < 5000u; ++current_tick) {
+        //Delays relative to the next tick to process
+        for (u32 i = 0u; i < 4u; ++i) {
+            const u64 delay = rand.next_range(0u, 600u);
+            expiry.push_back(wheel.now() + delay);
+            wheel.insert(skl::htimer_wheel::make_handle(u32(expiry.size() - 1u), 1u), expiry.back());
+        }
+
+        (void)wheel.advance(current_tick, on_expired);
+    }
+
+    ASSERT_TRUE(all_on_time);
+    ASSERT_EQ(expired + wheel.size(), expiry.size());
+}
+
+TEST(SkylakeHTimerWheel, cancel) {
+    small_wheel_t wheel{};
+
+    const auto h0 = skl::htimer_wheel::make_handle(0u, 1u);
+    const auto h1 = skl::htimer_wheel::make_handle(1u, 1u);
+    const auto h2 = skl::htimer_wheel::make_handle(2u, 1u);
+
+    wheel.insert(h0, 5u);
+    wheel.insert(h1, 5u);
+    wheel.insert(h2, 100u);
+
+    //Stale generation
+    ASSERT_FALSE(wheel.cancel(skl::htimer_wheel::make_handle(1u, 2u)));
+    ASSERT_FALSE(wheel.cancel(skl::htimer_wheel::make_handle(99u, 1u)));
+
+    ASSERT_TRUE(wheel.cancel(h1));
+    ASSERT_FALSE(wheel.cancel(h1));
+    ASSERT_TRUE(wheel.cancel(h2));
+    ASSERT_EQ(wheel.size(), 1u);
+
+    //Reused index replaces the old entry
+    const auto h0_new = skl::htimer_wheel::make_handle(0u, 2u);
+    wheel.insert(h0_new, 7u);
+    ASSERT_FALSE(wheel.contains(h0));
+    ASSERT_TRUE(wheel.contains(h0_new));
+    ASSERT_EQ(wheel.size(), 1u);
+
+    std::vector<handle_t> expired;
+    auto                  on_expired = [&expired](handle_t f_handle) noexcept { expired.push_back(f_handle); };
+    (void)wheel.advance(200u, on_expired);
+
+    ASSERT_EQ(expired.size(), 1u);
+    ASSERT_EQ(expired[0u], h0_new);
+    ASSERT_FALSE(wheel.cancel(h0_new));
+}
+
+namespace {
+using service_t = skl::HTimerWheel<4u, 1024u, 64u>;
+
+struct fired_t {
+    handle_t m_handle;
+    u64      m_payload;
+    u64      m_time;
+};
+
+u64 g_objects_alive = 0u;
+
+struct tracked_t {
+    tracked_t() noexcept {
+        ++g_objects_alive;
+    }
+    tracked_t(const tracked_t&) noexcept {
+        ++g_objects_alive;
+    }
+    ~tracked_t() noexcept {
+        --g_objects_alive;
+    }
+};
+} // namespace
+
+TEST(SkylakeHTimerWheel, service_handle_events) {
+    auto  service_ptr = std::make_unique<service_t>();
+    auto& service     = *service_ptr;
+
+    constexpr u64 CStart = 1'000'000u;
+    service.set_start_time(CStart);
+
+    std::vector<fired_t> fired;
+    u64                  now     = CStart;
+    auto                 handler = [&](handle_t f_handle, u64 f_payload) noexcept { fired.push_back({f_handle, f_payload, now}); };
+
+    //Delays up to ~5 minutes (multiple cascades)
+    skl::SklRand            rand{};
+    std::vector<handle_t> handles;
+    std::vector<u64>      delays;
+    for (u32 i = 0u; i < 2000u; ++i) {
+        delays.push_back(rand.next_range(0u, 300'000u));
+        handles.push_back(service.schedule(delays.back(), i, now));
+    }
+    ASSERT_EQ(service.pending_count(), 2000u);
+
+    //Cancel every 4th
+    for (u32 i = 0u; i < handles.size(); i += 4u) {
+        ASSERT_TRUE(service.cancel(handles[i]));
+        ASSERT_FALSE(service.is_pending(handles[i]));
+    }
+
+    for (; now <= CStart + 300'000u + (2u * service_t::CGranularityMs); now += service_t::CGranularityMs) {
+        (void)service.update(handler);
+        (void)service.timer_tick(now);
+    }
+    (void)service.update(handler);
+
+    ASSERT_EQ(fired.size(), 1500u);
+    ASSERT_EQ(service.pending_count(), 0u);
+    ASSERT_EQ(service.timer_entries_count(), 0u);
+
+    for (const auto& event : fired) {
+        ASSERT_NE(event.m_payload % 4u, 0u);
+        ASSERT_EQ(event.m_handle, handles[event.m_payload]);
+
+        //Never early, at most one tick late (+ one main tick for the dispatch)
+        const u64 expected = CStart + delays[event.m_payload];
+        ASSERT_GE(event.m_time, expected);
+        ASSERT_LE(event.m_time, expected + (2u * service_t::CGranularityMs));
+    }
+
+    //Fired handles are no longer valid
+    ASSERT_FALSE(service.cancel(fired[0u].m_handle));
+}
+
+TEST(SkylakeHTimerWheel, service_object_events) {
+    auto  service_ptr = std::make_unique<service_t>();
+    auto& service     = *service_ptr;
+
+    u64  now     = 5000u;
+    auto handler = [](handle_t, u64) noexcept { FAIL(); };
+    service.set_start_time(now);
+
+    u64       calls = 0u;
+    tracked_t tracked{};
+    ASSERT_EQ(g_objects_alive, 1u);
+
+    const auto h0 = service.schedule_object(10u, [&calls, tracked]() noexcept { ++calls; }, now);
+    const auto h1 = service.schedule_object(20u, [&calls, tracked]() noexcept { calls += 100u; }, now);
+    ASSERT_EQ(g_objects_alive, 3u);
+
+    //Rescheduling from the callback
+    handle_t   h3 = skl::htimer_wheel::CInvalidHandle;
+    const auto h2 = service.schedule_object(
+        8u, [&service, &calls, &h3, &now]() noexcept {
+            h3 = service.schedule_object(8u, [&calls]() noexcept { calls += 10'000u; }, now);
+        },
+        now);
+    (void)h2;
+
+    ASSERT_TRUE(service.cancel(h1));
+
+    for (u32 i = 0u; i < 20u; ++i, now += service_t::CGranularityMs) {
+        (void)service.update(handler);
+        (void)service.timer_tick(now);
+    }
+    (void)service.update(handler);
+
+    ASSERT_EQ(calls, 10'001u);
+    ASSERT_NE(h3, skl::htimer_wheel::CInvalidHandle);
+    ASSERT_FALSE(service.is_pending(h0));
+    ASSERT_EQ(g_objects_alive, 1u); //Fired and cancelled callables destroyed
+    ASSERT_EQ(service.pending_count(), 0u);
+
+    //Pending callables are destroyed with the wheel
+    (void)service.schedule_object(1000u, [tracked]() noexcept { }, now);
+    ASSERT_EQ(g_objects_alive, 2u);
+    service_ptr.reset();
+    ASSERT_EQ(g_objects_alive, 1u);
+}
+
+TEST(SkylakeHTimerWheel, service_cancel_after_trigger) {
+    auto  service_ptr = std::make_unique<service_t>();
+    auto& service     = *service_ptr;
+
+    u64 now = 0u;
+    service.set_start_time(now);
+
+    u64  fired   = 0u;
+    auto handler = [&fired](handle_t, u64) noexcept { ++fired; };
+
+    const auto handle = service.schedule(4u, 1u, now);
+    (void)service.update(handler);
+
+    //Timer triggers it, the main thread cancels before seeing the trigger
+    now += 8u;
+    ASSERT_EQ(service.timer_tick(now), 1u);
+    ASSERT_TRUE(service.cancel(handle));
+
+    (void)service.update(handler);
+    ASSERT_EQ(fired, 0u);
+    (void)service.timer_tick(now);
+    ASSERT_EQ(service.pending_count(), 0u);
+}
+
+TEST(SkylakeHTimerWheel, service_rings_backlog) {
+    //Tiny rings, everything goes through the backlogs
+    using tiny_service_t = skl::HTimerWheel<4u, 16u, 16u>;
+    auto  service_ptr    = std::make_unique<tiny_service_t>();
+    auto& service        = *service_ptr;
+
+    u64 now = 0u;
+    service.set_start_time(now);
+
+    u64  fired   = 0u;
+    auto handler = [&fired](handle_t, u64) noexcept { ++fired; };
+
+    for (u32 i = 0u; i < 1000u; ++i) {
+        (void)service.schedule(i % 50u, i, now);
+    }
+
+    for (u32 i = 0u; i < 200u; ++i, now += tiny_service_t::CGranularityMs) {
+        (void)service.update(handler);
+        (void)service.timer_tick(now);
+    }
+
+    ASSERT_EQ(fired, 1000u);
+    ASSERT_EQ(service.pending_count(), 0u);
+}
+
+TEST(SkylakeHTimerWheel, service_stop_start) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    auto  service_ptr = std::make_unique<service_t>();
+    auto& service     = *service_ptr;
+
+    u64  fired   = 0u;
+    auto handler = [&fired](handle_t, u64) noexcept { ++fired; };
+
+    //Dispatch until \p f_count events fired, returns the epoch time it happened at
+    auto wait_fired = [&](u64 f_count) noexcept -> u64 {
+        const u64 start = skl::get_current_epoch_time();
+        u64       now   = start;
+        while ((fired < f_count) && ((now - start) < 5'000u)) {
+            (void)service.update(handler);
+            skl::skl_sleep(1u);
+            now = skl::get_current_epoch_time();
+        }
+        return now;
+    };
+
+    //First run, the wheel advances ~250 ticks
+    ASSERT_TRUE(service.start().is_success());
+    (void)service.schedule(1'000u, 0u);
+    (void)wait_fired(1u);
+    ASSERT_EQ(fired, 1u);
+    ASSERT_TRUE(service.stop().is_success());
+    ASSERT_FALSE(service.is_running());
+
+    skl::skl_sleep(100u);
+
+    //Second run, a short timer must not wait for the ticks of the first run to elapse again
+    ASSERT_TRUE(service.start().is_success());
+    const u64 scheduled_at = skl::get_current_epoch_time();
+    (void)service.schedule(20u, 1u, scheduled_at);
+    const u64 fired_at = wait_fired(2u);
+    ASSERT_EQ(fired, 2u);
+    ASSERT_GE(fired_at - scheduled_at, 20u);
+    ASSERT_LT(fired_at - scheduled_at, 500u);
+
+    ASSERT_TRUE(service.stop().is_success());
+    ASSERT_EQ(service.pending_count(), 0u);
+
+    service_ptr.reset();
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
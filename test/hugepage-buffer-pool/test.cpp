@@ -1,12 +1,15 @@
 #include <skl_pool/hugepage_buffer_pool>
 #include <skl_huge_pages>
 #include <skl_core>
+#include <skl_core_info>
 
 #include <gtest/gtest.h>
 #include <vector>
 #include <random>
 #include <set>
 #include <chrono>
+#include <thread>
+#include <mutex>
 
 using Pool = skl::HugePageBufferPool;
 
@@ -1772,3 +1775,196 @@ TEST_F(HugePageBufferPoolTest, HighChurnAllocationPattern) {
     std::memset(test_buffer.buffer, 0xAB, 1024);
     Pool::buffer_free(test_buffer);
 }
+
+// =============================================================================
+// NUMA Partitioning Tests (fake topology, runs on single node machines)
+// =============================================================================
+
+namespace {
+//! Two nodes, even cpus on node 0 and odd cpus on node 1
+skl::numa_topology_t make_fake_two_nodes_topology() noexcept {
+    skl::numa_topology_t topology{};
+    topology.m_nodes_count = 2U;
+    for (u32 cpu = 0U; cpu < skl::CNumaMaxCpus; ++cpu) {
+        topology.m_cpu_to_node[cpu] = u8(cpu & 1U);
+    }
+    return topology;
+}
+} // namespace
+
+TEST_F(HugePageBufferPoolTest, NumaConstructWithTopology) {
+    ASSERT_EQ(Pool::numa_nodes_count(), skl::skl_core_get_numa_topology().m_nodes_count);
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::numa_nodes_count(), 0U);
+
+    skl::numa_topology_t topology{};
+    topology.m_nodes_count = 0U;
+    ASSERT_EQ(Pool::construct_pool(topology), SKL_ERR_PARAMS);
+    topology.m_nodes_count = skl::CNumaMaxNodes + 1U;
+    ASSERT_EQ(Pool::construct_pool(topology), SKL_ERR_PARAMS);
+
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_SUCCESS);
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_ERR_STATE);
+    ASSERT_EQ(Pool::numa_nodes_count(), 2U);
+    ASSERT_TRUE(Pool::get_numa_node_stats(1U).is_success());
+    ASSERT_FALSE(Pool::get_numa_node_stats(2U).is_success());
+}
+
+TEST_F(HugePageBufferPoolTest, NumaThreadNodeResolvedFromCpu) {
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_SUCCESS);
+
+    Pool::reset_thread_numa_node();
+    const i32 cpu = sched_getcpu();
+    ASSERT_GE(cpu, 0);
+    ASSERT_EQ(Pool::thread_numa_node(), u32(cpu) & 1U);
+
+    auto buffer = Pool::buffer_alloc(64);
+    ASSERT_TRUE(buffer.is_valid());
+    ASSERT_EQ(Pool::buffer_get_numa_node(buffer.buffer), u32(cpu) & 1U);
+    Pool::buffer_free(buffer);
+
+    Pool::reset_thread_numa_node();
+}
+
+TEST_F(HugePageBufferPoolTest, NumaAllocFromThreadNode) {
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_SUCCESS);
+
+    constexpr u32 CCount = 100U;
+    std::vector<Pool::buffer_t> buffers[2U];
+    for (u32 node = 0U; node < 2U; ++node) {
+        Pool::set_thread_numa_node(node);
+        ASSERT_EQ(Pool::thread_numa_node(), node);
+        for (u32 i = 0U; i < CCount; ++i) {
+            auto buffer = Pool::buffer_alloc(256);
+            ASSERT_TRUE(buffer.is_valid());
+            ASSERT_EQ(Pool::buffer_get_numa_node(buffer.buffer), node);
+            std::memset(buffer.buffer, int(node + 1U), buffer.length);
+            buffers[node].push_back(buffer);
+        }
+    }
+
+    // Partitions do not share pages
+    std::set<u64> node0_pages;
+    for (const auto& buffer : buffers[0U]) {
+        node0_pages.insert(reinterpret_cast<u64>(buffer.buffer) / skl::huge_pages::CHugePageSize);
+    }
+    for (const auto& buffer : buffers[1U]) {
+        ASSERT_FALSE(node0_pages.contains(reinterpret_cast<u64>(buffer.buffer) / skl::huge_pages::CHugePageSize));
+        ASSERT_EQ(buffer.buffer[0], 2U);
+    }
+
+    for (u32 node = 0U; node < 2U; ++node) {
+        const auto stats = Pool::get_numa_node_stats(node).value();
+        ASSERT_EQ(stats.m_pages_count, 1U);
+        ASSERT_EQ(stats.m_alloc_count, CCount);
+        ASSERT_EQ(stats.m_allocated_count, CCount);
+        ASSERT_EQ(stats.m_allocated_bytes, CCount * 512U);
+        ASSERT_EQ(stats.m_remote_free_count, 0U);
+    }
+
+    for (u32 node = 0U; node < 2U; ++node) {
+        Pool::set_thread_numa_node(node);
+        for (auto& buffer : buffers[node]) {
+            Pool::buffer_free(buffer);
+        }
+        ASSERT_EQ(Pool::get_numa_node_stats(node).value().m_allocated_count, 0U);
+        ASSERT_EQ(Pool::get_numa_node_stats(node).value().m_allocated_bytes, 0U);
+    }
+
+    Pool::reset_thread_numa_node();
+}
+
+TEST_F(HugePageBufferPoolTest, NumaFreeGoesBackToOwningNode) {
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_SUCCESS);
+
+    Pool::set_thread_numa_node(0U);
+    auto buffer = Pool::buffer_alloc(1000);
+    ASSERT_TRUE(buffer.is_valid());
+    byte* const first_ptr = buffer.buffer;
+
+    // Freed by a thread running on node 1
+    std::thread remote_thread([buffer]() {
+        Pool::set_thread_numa_node(1U);
+        Pool::buffer_free(buffer);
+    });
+    remote_thread.join();
+
+    const auto node0 = Pool::get_numa_node_stats(0U).value();
+    ASSERT_EQ(node0.m_allocated_count, 0U);
+    ASSERT_EQ(node0.m_remote_free_count, 1U);
+    ASSERT_EQ(Pool::get_numa_node_stats(1U).value().m_alloc_count, 0U);
+    ASSERT_EQ(Pool::get_numa_node_stats(1U).value().m_pages_count, 0U);
+
+    // The buffer is reused by node 0 (LIFO)
+    auto again = Pool::buffer_alloc(1000);
+    ASSERT_EQ(again.buffer, first_ptr);
+    Pool::buffer_free(again);
+
+    Pool::reset_thread_numa_node();
+}
+
+TEST_F(HugePageBufferPoolTest, NumaConcurrentCrossNodeAllocFree) {
+    Pool::destroy_pool();
+    ASSERT_EQ(Pool::construct_pool(make_fake_two_nodes_topology()), SKL_SUCCESS);
+
+    constexpr u32 CThreads    = 4U;
+    constexpr u32 CIterations = 50000U;
+    constexpr u64 CMaxShared  = 256U;
+
+    // Buffers are handed to whichever thread comes next, most frees happen on another thread (and node)
+    std::mutex                  shared_lock;
+    std::vector<Pool::buffer_t> shared;
+    std::vector<std::thread>    threads;
+    for (u32 t = 0U; t < CThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            const u32 node = t & 1U;
+            Pool::set_thread_numa_node(node);
+            for (u32 i = 0U; i < CIterations; ++i) {
+                auto buffer = Pool::buffer_alloc(32U + ((i * 37U) % 2000U));
+                SKL_ASSERT_PERMANENT(buffer.is_valid());
+                SKL_ASSERT_PERMANENT(Pool::buffer_get_numa_node(buffer.buffer) == node);
+                buffer.buffer[0] = byte(t);
+
+                Pool::buffer_t to_free{};
+                {
+                    std::lock_guard guard{shared_lock};
+                    shared.push_back(buffer);
+                    if (shared.size() > CMaxShared) {
+                        to_free = shared.front();
+                        shared.erase(shared.begin());
+                    }
+                }
+
+                if (to_free.is_valid()) {
+                    Pool::buffer_free(to_free);
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto& buffer : shared) {
+        Pool::buffer_free(buffer);
+    }
+
+    u64 total_allocs       = 0U;
+    u64 total_remote_frees = 0U;
+    for (u32 node = 0U; node < 2U; ++node) {
+        const auto stats = Pool::get_numa_node_stats(node).value();
+        ASSERT_EQ(stats.m_allocated_count, 0U);
+        ASSERT_EQ(stats.m_allocated_bytes, 0U);
+        ASSERT_GT(stats.m_pages_count, 0U);
+        total_allocs += stats.m_alloc_count;
+        total_remote_frees += stats.m_remote_free_count;
+    }
+    ASSERT_EQ(total_allocs, u64(CThreads) * CIterations);
+    ASSERT_GT(total_remote_frees, 0U);
+
+    Pool::reset_thread_numa_node();
+}
@@ -0,0 +1,286 @@
+#include <skl_job_system>
+#include <skl_core>
+#include <skl_core_info>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using skl::job_t;
+
+namespace {
+using test_deque_t = skl::work_stealing_deque_t<u32, 256U>;
+
+class skylake_job_system_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_TRUE(skl::skl_core_init().is_success());
+    }
+};
+
+//! Fibonacci by recursive forking, every level waits on its children
+u64 fib_fork_join(skl::job_system_t& f_system, u32 f_n) noexcept {
+    if (f_n < 12U) {
+        u64 a = 0U;
+        u64 b = 1U;
+        for (u32 i = 0U; i < f_n; ++i) {
+            const u64 c = a + b;
+            a           = b;
+            b           = c;
+        }
+        return a;
+    }
+
+    u64    left   = 0U;
+    u64    right  = 0U;
+    job_t* parent = f_system.create_job([]() noexcept {});
+
+    f_system.run(f_system.create_child_job(*parent, [&f_system, &left, f_n]() noexcept { left = fib_fork_join(f_system, f_n - 1U); }));
+    f_system.run(f_system.create_child_job(*parent, [&f_system, &right, f_n]() noexcept { right = fib_fork_join(f_system, f_n - 2U); }));
+    f_system.run(parent);
+    f_system.wait(parent);
+
+    return left + right;
+}
+} // namespace
+
+TEST(SkylakeWorkStealingDeque, owner_lifo_thief_fifo) {
+    // [ThreadLocal] Pop returns the last pushed item, steal the first pushed one
+    test_deque_t deque;
+    u32          items[4U] = {0U, 1U, 2U, 3U};
+
+    ASSERT_EQ(nullptr, deque.pop());
+    ASSERT_EQ(nullptr, deque.steal());
+
+    for (auto& item : items) {
+        ASSERT_TRUE(deque.push(&item));
+    }
+    ASSERT_EQ(4U, deque.size());
+
+    ASSERT_EQ(&items[3U], deque.pop());
+    ASSERT_EQ(&items[0U], deque.steal());
+    ASSERT_EQ(&items[2U], deque.pop());
+    ASSERT_EQ(&items[1U], deque.steal());
+    ASSERT_EQ(nullptr, deque.pop());
+    ASSERT_EQ(nullptr, deque.steal());
+    ASSERT_TRUE(deque.empty());
+}
+
+TEST(SkylakeWorkStealingDeque, full) {
+    test_deque_t deque;
+    u32          item = 0U;
+
+    for (u32 i = 0U; i < test_deque_t::CCapacity; ++i) {
+        ASSERT_TRUE(deque.push(&item));
+    }
+    ASSERT_FALSE(deque.push(&item));
+
+    ASSERT_EQ(&item, deque.steal());
+    ASSERT_TRUE(deque.push(&item));
+}
+
+TEST(SkylakeWorkStealingDeque, concurrent_steal_takes_each_item_once) {
+    // [ThreadSafe] One owner pushing/popping, 3 thieves, every item is taken exactly once
+    constexpr u32 CItems   = 200000U;
+    constexpr u32 CThieves = 3U;
+
+    test_deque_t                  deque;
+    std::vector<u32>              values(CItems);
+    std::vector<std::atomic<u32>> taken(CItems);
+    std::atomic<u32>              taken_count{0U};
+    std::atomic<bool>             done{false};
+
+    const auto take = [&](u32* f_item) noexcept {
+        taken[*f_item].fetch_add(1U, std::memory_order_relaxed);
+        taken_count.fetch_add(1U, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> thieves;
+    for (u32 i = 0U; i < CThieves; ++i) {
+        thieves.emplace_back([&]() noexcept {
+            while (false == done.load(std::memory_order_acquire)) {
+                if (u32* item = deque.steal(); nullptr != item) {
+                    take(item);
+                }
+            }
+        });
+    }
+
+    for (u32 i = 0U; i < CItems; ++i) {
+        values[i] = i;
+        while (false == deque.push(&values[i])) {
+            if (u32* item = deque.pop(); nullptr != item) {
+                take(item);
+            }
+        }
+
+        // Pop every 3rd push to race the thieves on the last item
+        if (0U == (i % 3U)) {
+            if (u32* item = deque.pop(); nullptr != item) {
+                take(item);
+            }
+        }
+    }
+    while (u32* item = deque.pop()) {
+        take(item);
+    }
+    while (CItems != taken_count.load(std::memory_order_relaxed)) {
+        std::this_thread::yield();
+    }
+
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    for (u32 i = 0U; i < CItems; ++i) {
+        ASSERT_EQ(1U, taken[i].load()) << "item " << i;
+    }
+}
+
+TEST_F(skylake_job_system_test_t, create_destroy) {
+    skl::job_system_t system;
+    ASSERT_FALSE(system.is_created());
+
+    ASSERT_TRUE(system.create({.m_workers_count = 3U}).is_success());
+    ASSERT_TRUE(system.is_created());
+    ASSERT_EQ(3U, system.workers_count());
+    ASSERT_EQ(0U, system.current_worker_index());
+
+    // Already created, the calling thread already belongs to a job system
+    ASSERT_EQ(SKL_ERR_STATE, system.create({.m_workers_count = 3U}));
+    skl::job_system_t other;
+    ASSERT_EQ(SKL_ERR_STATE, other.create({.m_workers_count = 3U}));
+
+    system.destroy();
+    ASSERT_FALSE(system.is_created());
+
+    ASSERT_EQ(SKL_ERR_PARAMS, system.create({.m_workers_count = skl::job_system_t::CMaxWorkers + 1U}));
+    ASSERT_TRUE(system.create({.m_workers_count = 0U, .m_pinning = skl::EJobWorkerPinning::None}).is_success());
+    ASSERT_EQ(u32(skl::skl_core_get_available_cpus().size()), system.workers_count());
+}
+
+TEST_F(skylake_job_system_test_t, single_worker) {
+    // [ThreadLocal] Without worker threads the jobs are run by wait()
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 1U}).is_success());
+
+    u32    counter = 0U;
+    job_t* root    = system.create_job([&counter]() noexcept { ++counter; });
+    for (u32 i = 0U; i < 100U; ++i) {
+        system.run(system.create_child_job(*root, [&counter]() noexcept { ++counter; }));
+    }
+    ASSERT_FALSE(root->is_finished());
+
+    system.run(root);
+    system.wait(root);
+    ASSERT_TRUE(root->is_finished());
+    ASSERT_EQ(101U, counter);
+}
+
+TEST_F(skylake_job_system_test_t, children_finish_before_parent) {
+    // [Fork-Join] The parent is finished only after its children (and grandchildren) finished
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 4U}).is_success());
+
+    constexpr u32 CChildren      = 64U;
+    constexpr u32 CGrandchildren = 32U;
+
+    std::atomic<u32> counter{0U};
+    job_t*           root = system.create_job([&system, &counter](job_t& f_root) noexcept {
+        for (u32 i = 0U; i < CChildren; ++i) {
+            system.run(system.create_child_job(f_root, [&system, &counter](job_t& f_child) noexcept {
+                for (u32 j = 0U; j < CGrandchildren; ++j) {
+                    system.run(system.create_child_job(f_child, [&counter]() noexcept { counter.fetch_add(1U, std::memory_order_relaxed); }));
+                }
+            }));
+        }
+    });
+
+    system.run(root);
+    system.wait(root);
+    ASSERT_EQ(CChildren * CGrandchildren, counter.load());
+}
+
+TEST_F(skylake_job_system_test_t, parallel_for_covers_range_once) {
+    // [Fork-Join] Every index is visited exactly once, for several grain sizes
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 4U}).is_success());
+
+    constexpr u32                 CCount = 100003U;
+    std::vector<std::atomic<u32>> visits(CCount);
+
+    for (const u32 grain : {0U, 1U, 7U, 1024U, CCount, CCount * 2U}) {
+        for (auto& visit : visits) {
+            visit.store(0U, std::memory_order_relaxed);
+        }
+
+        system.parallel_for(0U, CCount, grain, [&visits](u32 f_begin, u32 f_end) noexcept {
+            for (u32 i = f_begin; i < f_end; ++i) {
+                visits[i].fetch_add(1U, std::memory_order_relaxed);
+            }
+        });
+
+        for (u32 i = 0U; i < CCount; ++i) {
+            ASSERT_EQ(1U, visits[i].load(std::memory_order_relaxed)) << "grain " << grain << " index " << i;
+        }
+    }
+
+    // Empty range
+    bool called = false;
+    system.parallel_for(10U, 10U, 1U, [&called](u32, u32) noexcept { called = true; });
+    ASSERT_FALSE(called);
+}
+
+TEST_F(skylake_job_system_test_t, job_pool_wraps_around) {
+    // [Fork-Join] More jobs in flight than CJobPoolSize, the unfinished parent slot is skipped when the pool wraps
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 2U}).is_success());
+
+    std::atomic<u32> counter{0U};
+    constexpr u32    CJobs = (skl::job_system_t::CJobPoolSize * 3U) + 17U;
+
+    job_t* root = system.create_job([]() noexcept {});
+    for (u32 i = 0U; i < CJobs; ++i) {
+        system.run(system.create_child_job(*root, [&counter]() noexcept { counter.fetch_add(1U, std::memory_order_relaxed); }));
+    }
+
+    system.run(root);
+    system.wait(root);
+    ASSERT_EQ(CJobs, counter.load());
+}
+
+TEST_F(skylake_job_system_test_t, recursive_fork_join_with_parked_workers) {
+    // [Fork-Join] Nested waits inside jobs, the workers park (no spin) between the runs
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 4U, .m_pinning = skl::EJobWorkerPinning::None, .m_idle_spin_count = 0U}).is_success());
+
+    for (u32 i = 0U; i < 5U; ++i) {
+        ASSERT_EQ(6765U, fib_fork_join(system, 20U));
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
+
+TEST_F(skylake_job_system_test_t, wait_parks_until_finished) {
+    // [Fork-Join] Nothing left to steal while a worker runs a slow child, wait() parks and is woken when the job finishes
+    skl::job_system_t system;
+    ASSERT_TRUE(system.create({.m_workers_count = 2U, .m_pinning = skl::EJobWorkerPinning::None, .m_idle_spin_count = 0U}).is_success());
+
+    for (u32 i = 0U; i < 5U; ++i) {
+        std::atomic<u32> done{0U};
+        job_t*           root = system.create_job([]() noexcept {});
+        system.run(system.create_child_job(*root, [&done]() noexcept {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            done.fetch_add(1U, std::memory_order_relaxed);
+        }));
+
+        // Give the worker time to steal the child, then queue the root
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        system.run(root);
+        system.wait(root);
+
+        ASSERT_TRUE(root->is_finished());
+        ASSERT_EQ(1U, done.load());
+    }
+}
@@ -0,0 +1,216 @@
+#include <skl_mpmc_queue>
+#include <skl_huge_pages>
+
+#include <skl_core>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <memory>
+#include <vector>
+
+namespace {
+struct message_t {
+    u32 m_producer;
+    u32 m_sequence;
+};
+
+// Test object with non-trivial constructor/destructor for hugepage tests
+struct tracked_object_t {
+    static inline u32 construct_count = 0;
+    static inline u32 destruct_count  = 0;
+
+    u64 value = 0;
+
+    tracked_object_t() noexcept { ++construct_count; }
+    ~tracked_object_t() noexcept { ++destruct_count; }
+
+    tracked_object_t& operator=(const tracked_object_t&) noexcept = default;
+
+    static void reset_counters() noexcept {
+        construct_count = 0;
+        destruct_count  = 0;
+    }
+};
+} // namespace
+
+TEST(SkylakeMPMCQueue, SingleThreadFIFO) {
+    auto queue = std::make_unique<skl::mpmc_queue_t<u64, 16U, false>>();
+    ASSERT_TRUE(queue->empty());
+
+    for (u64 i = 0U; i < 16U; ++i) {
+        ASSERT_TRUE(queue->try_enqueue(i));
+    }
+    ASSERT_FALSE(queue->try_enqueue(16U));
+    ASSERT_EQ(queue->size(), 16U);
+
+    u64 value = 0U;
+    for (u64 i = 0U; i < 16U; ++i) {
+        ASSERT_TRUE(queue->try_dequeue(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue->try_dequeue(value));
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(SkylakeMPMCQueue, Bursts) {
+    auto queue = std::make_unique<skl::mpmc_queue_t<u64, 16U, false>>();
+
+    u64 input[24U];
+    for (u64 i = 0U; i < 24U; ++i) {
+        input[i] = i;
+    }
+
+    // Partial enqueue when there is not enough room
+    ASSERT_EQ(queue->try_enqueue_burst(input, 10U), 10U);
+    ASSERT_EQ(queue->try_enqueue_burst(input + 10U, 14U), 6U);
+    ASSERT_EQ(queue->try_enqueue_burst(input, 1U), 0U);
+
+    u64 output[24U]{};
+    ASSERT_EQ(queue->try_dequeue_burst(output, 4U), 4U);
+    ASSERT_EQ(queue->try_dequeue_burst(output + 4U, 24U), 12U);
+    for (u64 i = 0U; i < 16U; ++i) {
+        ASSERT_EQ(output[i], i);
+    }
+    ASSERT_EQ(queue->try_dequeue_burst(output, 24U), 0U);
+
+    // Wraps around the end of the buffer
+    for (u32 lap = 0U; lap < 8U; ++lap) {
+        ASSERT_EQ(queue->try_enqueue_burst(input, 11U), 11U);
+        ASSERT_EQ(queue->try_dequeue_burst(output, 24U), 11U);
+        ASSERT_EQ(output[0U], 0U);
+        ASSERT_EQ(output[10U], 10U);
+    }
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(SkylakeMPMCQueue, MultipleProducersMultipleConsumers) {
+    constexpr u32 CProducers         = 4U;
+    constexpr u32 CConsumers         = 4U;
+    constexpr u32 CMessagesPerThread = 50000U;
+    constexpr u64 CTotal             = u64(CProducers) * CMessagesPerThread;
+
+    auto queue = std::make_unique<skl::mpmc_queue_t<message_t, 256U, false>>();
+
+    std::vector<std::relaxed_value<u32>> received(CTotal);
+    std::relaxed_value<u64>              consumed{0U};
+
+    std::vector<std::thread> threads;
+    for (u32 p = 0U; p < CProducers; ++p) {
+        threads.emplace_back([&queue, p]() noexcept {
+            message_t burst[8U];
+            for (u32 i = 0U; i < CMessagesPerThread;) {
+                if (0U == (p & 1U)) {
+                    queue->enqueue({p, i});
+                    ++i;
+                } else {
+                    const u32 count = (CMessagesPerThread - i) < 8U ? (CMessagesPerThread - i) : 8U;
+                    for (u32 j = 0U; j < count; ++j) {
+                        burst[j] = {p, i + j};
+                    }
+                    queue->enqueue_burst(burst, count);
+                    i += count;
+                }
+            }
+        });
+    }
+
+    for (u32 c = 0U; c < CConsumers; ++c) {
+        threads.emplace_back([&queue, &received, &consumed, c]() noexcept {
+            message_t burst[8U];
+            while (consumed.load_acquire() < CTotal) {
+                u32 count = 0U;
+                if (0U == (c & 1U)) {
+                    count = queue->try_dequeue(burst[0U]) ? 1U : 0U;
+                } else {
+                    count = queue->try_dequeue_burst(burst, 8U);
+                }
+
+                for (u32 i = 0U; i < count; ++i) {
+                    (void)received[(u64(burst[i].m_producer) * CMessagesPerThread) + burst[i].m_sequence].increment();
+                }
+                if (0U < count) {
+                    (void)consumed.increment(count);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(consumed.load_acquire(), CTotal);
+    for (u64 i = 0U; i < CTotal; ++i) {
+        ASSERT_EQ(received[i].load_relaxed(), 1U);
+    }
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(SkylakeMPMCQueue, BlockingDequeueWaitsForProducer) {
+    auto queue = std::make_unique<skl::mpmc_queue_t<u64, 4U, false>>();
+
+    std::thread consumer{[&queue]() noexcept {
+        u64 sum = 0U;
+        for (u64 i = 0U; i < 1000U;) {
+            u64       values[4U];
+            const u32 count = queue->dequeue_burst(values, 4U);
+            for (u32 j = 0U; j < count; ++j) {
+                sum += values[j];
+            }
+            i += count;
+        }
+        u64 last = 0U;
+        queue->dequeue(last);
+        ASSERT_EQ(sum, 499500U);
+        ASSERT_EQ(last, 4242U);
+    }};
+
+    // The queue holds only 4 objects, enqueue() waits for the consumer
+    for (u64 i = 0U; i < 1000U; ++i) {
+        queue->enqueue(i);
+    }
+    queue->enqueue(4242U);
+
+    consumer.join();
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST(SkylakeMPMCQueue, HugePagesStorage) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    if (!skl::huge_pages::is_huge_pages_enabled()) {
+        ASSERT_TRUE(skl::skl_core_deinit().is_success());
+        GTEST_SKIP() << "Hugepages not available";
+    }
+
+    constexpr u64 Size = 128U;
+    using queue_t      = skl::mpmc_queue_t<tracked_object_t, Size, true>;
+
+    tracked_object_t::reset_counters();
+    {
+        queue_t queue{};
+        ASSERT_FALSE(queue.has_internal_storage());
+
+        queue.allocate_internal_storage();
+        ASSERT_TRUE(queue.has_internal_storage());
+        ASSERT_EQ(tracked_object_t::construct_count, Size);
+
+        tracked_object_t object{};
+        for (u64 i = 0U; i < Size; ++i) {
+            object.value = i;
+            ASSERT_TRUE(queue.try_enqueue(object));
+        }
+        ASSERT_FALSE(queue.try_enqueue(object));
+
+        for (u64 i = 0U; i < Size; ++i) {
+            ASSERT_TRUE(queue.try_dequeue(object));
+            ASSERT_EQ(object.value, i);
+        }
+    }
+    ASSERT_EQ(tracked_object_t::destruct_count, Size + 1U);
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
@@ -0,0 +1,263 @@
+#include <skl_mpsc_ring>
+#include <skl_huge_pages>
+
+#include <skl_core>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <memory>
+#include <vector>
+
+namespace {
+struct message_t {
+    u32 m_producer;
+    u32 m_sequence;
+};
+
+// Test object with non-trivial constructor/destructor for hugepage tests
+struct tracked_object_t {
+    static inline u32 construct_count = 0;
+    static inline u32 destruct_count  = 0;
+
+    u64 value = 0;
+
+    tracked_object_t() noexcept { ++construct_count; }
+    ~tracked_object_t() noexcept { ++destruct_count; }
+
+    static void reset_counters() noexcept {
+        construct_count = 0;
+        destruct_count  = 0;
+    }
+};
+
+struct sum_functor_t {
+    static inline u64 sum = 0U;
+
+    static void operator()(message_t& f_message) noexcept {
+        sum += f_message.m_sequence;
+    }
+};
+} // namespace
+
+TEST(SkylakeMPSCRing, SingleProducerFIFO) {
+    auto ring = std::make_unique<skl::mpsc_ring_t<message_t, 64U, false>>();
+    ASSERT_EQ(ring->free_count(), 64U);
+
+    for (u32 i = 0U; i < 10U; ++i) {
+        auto* message = ring->allocate();
+        ASSERT_NE(message, nullptr);
+        message->m_sequence = i;
+        ring->submit(message);
+    }
+    ASSERT_EQ(ring->usage_count(), 10U);
+    ASSERT_EQ(ring->pending_count(), 10U);
+
+    message_t* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 4U), 4U);
+    ASSERT_EQ(ring->dequeue_burst(burst + 4U, 16U), 6U);
+    for (u32 i = 0U; i < 10U; ++i) {
+        ASSERT_EQ(burst[i]->m_sequence, i);
+    }
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 0U);
+    ASSERT_EQ(ring->processed_count(), 10U);
+
+    ring->free_processed();
+    ASSERT_EQ(ring->processed_count(), 0U);
+    ASSERT_EQ(ring->free_count(), 64U);
+}
+
+TEST(SkylakeMPSCRing, FullAndWrapAround) {
+    auto ring = std::make_unique<skl::mpsc_ring_t<message_t, 8U, false>>();
+
+    message_t* burst[8U];
+    for (u32 lap = 0U; lap < 4U; ++lap) {
+        for (u32 i = 0U; i < 8U; ++i) {
+            auto* message = ring->allocate();
+            ASSERT_NE(message, nullptr);
+            message->m_sequence = (lap * 8U) + i;
+            ring->submit(message);
+        }
+        ASSERT_EQ(ring->allocate(), nullptr);
+        ASSERT_FALSE(ring->allocate_bulk(burst, 1U));
+
+        ASSERT_EQ(ring->dequeue_burst(burst, 8U), 8U);
+        for (u32 i = 0U; i < 8U; ++i) {
+            ASSERT_EQ(burst[i]->m_sequence, (lap * 8U) + i);
+        }
+
+        // Dequeued but not freed, still full
+        ASSERT_EQ(ring->allocate(), nullptr);
+        ring->free_processed();
+        ASSERT_EQ(ring->free_count(), 8U);
+    }
+}
+
+TEST(SkylakeMPSCRing, AllocateBulk) {
+    auto ring = std::make_unique<skl::mpsc_ring_t<message_t, 16U, false>>();
+
+    message_t* objects[16U];
+    ASSERT_TRUE(ring->allocate_bulk(objects, 12U));
+    ASSERT_FALSE(ring->allocate_bulk(objects + 12U, 5U));
+    for (u32 i = 0U; i < 12U; ++i) {
+        objects[i]->m_sequence = i;
+    }
+    ring->submit(objects, 12U);
+
+    ASSERT_EQ(ring->process_bulk<sum_functor_t>(16U), 12U);
+    ASSERT_EQ(sum_functor_t::sum, 66U);
+    ring->free_processed();
+
+    // Wraps around the end of the buffer
+    ASSERT_TRUE(ring->allocate_bulk(objects, 16U));
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ring->submit(objects, 16U);
+
+    u64  count   = 0U;
+    auto counter = [&count](message_t&) noexcept { ++count; };
+    ASSERT_EQ(ring->process(16U, counter), 16U);
+    ASSERT_EQ(count, 16U);
+    ring->free_processed();
+    ASSERT_EQ(ring->free_count(), 16U);
+}
+
+TEST(SkylakeMPSCRing, SlowProducerDoesNotBlockLaterSlots) {
+    auto ring = std::make_unique<skl::mpsc_ring_t<message_t, 8U, false>>();
+
+    // Slow producer claims first, publishes last
+    auto* slow = ring->allocate();
+    ASSERT_NE(slow, nullptr);
+    slow->m_sequence = 100U;
+
+    for (u32 i = 0U; i < 4U; ++i) {
+        auto* message       = ring->allocate();
+        message->m_sequence = i;
+        ring->submit(message);
+    }
+
+    message_t* burst[8U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 8U), 4U);
+    for (u32 i = 0U; i < 4U; ++i) {
+        ASSERT_EQ(burst[i]->m_sequence, i);
+    }
+    ring->free_processed();
+
+    // The slot of the slow producer is not freed, the claim head cannot pass it
+    ASSERT_EQ(ring->free_count(), 3U);
+    for (u32 i = 0U; i < 3U; ++i) {
+        auto* message       = ring->allocate();
+        message->m_sequence = 10U + i;
+        ring->submit(message);
+    }
+    ASSERT_EQ(ring->allocate(), nullptr);
+
+    ring->submit(slow);
+    ASSERT_EQ(ring->dequeue_burst(burst, 8U), 4U);
+    ASSERT_EQ(burst[0U]->m_sequence, 100U);
+    ASSERT_EQ(burst[1U]->m_sequence, 10U);
+    ASSERT_EQ(burst[3U]->m_sequence, 12U);
+    ring->free_processed();
+
+    ASSERT_EQ(ring->free_count(), 8U);
+    ASSERT_EQ(ring->pending_count(), 0U);
+    ASSERT_EQ(ring->processed_count(), 0U);
+}
+
+TEST(SkylakeMPSCRing, MultipleProducers) {
+    constexpr u32 CProducers         = 4U;
+    constexpr u32 CMessagesPerThread = 100000U;
+
+    auto ring = std::make_unique<skl::mpsc_ring_t<message_t, 256U, false>>();
+
+    std::vector<std::thread> producers;
+    for (u32 p = 0U; p < CProducers; ++p) {
+        producers.emplace_back([&ring, p]() noexcept {
+            message_t* objects[4U];
+            for (u32 i = 0U; i < CMessagesPerThread;) {
+                if (0U == (i & 1U)) {
+                    auto* message = ring->allocate();
+                    if (nullptr == message) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    *message = {p, i};
+                    ring->submit(message);
+                    ++i;
+                } else {
+                    const u32 count = (CMessagesPerThread - i) < 4U ? (CMessagesPerThread - i) : 4U;
+                    if (false == ring->allocate_bulk(objects, count)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (u32 j = 0U; j < count; ++j) {
+                        *objects[j] = {p, i + j};
+                    }
+                    ring->submit(objects, count);
+                    i += count;
+                }
+            }
+        });
+    }
+
+    std::vector<u8> received(u64(CProducers) * CMessagesPerThread, 0U);
+    u64             total = 0U;
+    message_t*      burst[32U];
+    while (total < u64(CProducers) * CMessagesPerThread) {
+        const u32 count = ring->dequeue_burst(burst, 32U);
+        for (u32 i = 0U; i < count; ++i) {
+            ASSERT_LT(burst[i]->m_producer, CProducers);
+            auto& flag = received[(u64(burst[i]->m_producer) * CMessagesPerThread) + burst[i]->m_sequence];
+            ASSERT_EQ(flag, 0U);
+            flag = 1U;
+        }
+        total += count;
+        ring->free_processed();
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    ASSERT_EQ(ring->dequeue_burst(burst, 32U), 0U);
+    ASSERT_EQ(ring->free_count(), 256U);
+}
+
+TEST(SkylakeMPSCRing, HugePagesStorage) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    if (!skl::huge_pages::is_huge_pages_enabled()) {
+        ASSERT_TRUE(skl::skl_core_deinit().is_success());
+        GTEST_SKIP() << "Hugepages not available";
+    }
+
+    constexpr u64 Size = 128U;
+    using ring_t       = skl::mpsc_ring_t<tracked_object_t, Size, true>;
+
+    tracked_object_t::reset_counters();
+    {
+        ring_t ring{};
+        ASSERT_FALSE(ring.has_internal_storage());
+
+        ring.allocate_internal_storage();
+        ASSERT_TRUE(ring.has_internal_storage());
+        ASSERT_EQ(tracked_object_t::construct_count, Size);
+
+        for (u64 i = 0U; i < Size; ++i) {
+            auto* object  = ring.allocate();
+            object->value = i;
+            ring.submit(object);
+        }
+        ASSERT_EQ(ring.allocate(), nullptr);
+
+        tracked_object_t* burst[Size];
+        ASSERT_EQ(ring.dequeue_burst(burst, u32(Size)), Size);
+        for (u64 i = 0U; i < Size; ++i) {
+            ASSERT_EQ(burst[i]->value, i);
+        }
+        ring.free_processed();
+        ASSERT_EQ(ring.free_count(), Size);
+    }
+    ASSERT_EQ(tracked_object_t::destruct_count, Size);
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
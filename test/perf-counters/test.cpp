@@ -0,0 +1,144 @@
+#include <skl_perf_counters>
+#include <skl_core>
+#include <skl_sleep>
+
+#include <thread>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+namespace {
+SKL_NOINLINE u64 busy_work(u64 f_count) noexcept {
+    u64 value = 1U;
+    for (u64 i = 0U; i < f_count; ++i) {
+        value = (value * 6364136223846793005ULL) + i;
+        asm volatile("" : "+r"(value));
+    }
+    return value;
+}
+} // namespace
+
+TEST(SkylakePerfCounters, CounterNames) {
+    ASSERT_STREQ(skl::skl_perf_counter_name(skl::EPerfCounter::Cycles), "cycles");
+    ASSERT_STREQ(skl::skl_perf_counter_name(skl::EPerfCounter::Instructions), "instructions");
+    ASSERT_STREQ(skl::skl_perf_counter_name(skl::EPerfCounter::DTLBMisses), "dtlb_misses");
+    ASSERT_STREQ(skl::skl_perf_counter_name(skl::EPerfCounter::Max), "unknown");
+}
+
+TEST(SkylakePerfCounters, OpenOrDegradeGracefully) {
+    skl::SKLPerfCounters counters{};
+    ASSERT_FALSE(counters.is_open());
+
+    const auto status = counters.open();
+    if (status.is_success()) {
+        ASSERT_TRUE(counters.is_open());
+        ASSERT_NE(counters.available_mask(), 0U);
+        ASSERT_EQ(counters.open(), SKL_OK_REDUNDANT);
+
+        const auto start = counters.read();
+        (void)busy_work(1'000'000U);
+        const auto delta = counters.read() - start;
+
+        ASSERT_EQ(delta.m_available_mask & ~counters.available_mask(), 0U);
+        if (delta.has(skl::EPerfCounter::Instructions)) {
+            ASSERT_GE(delta.get(skl::EPerfCounter::Instructions), 1'000'000U);
+        }
+        if (delta.has(skl::EPerfCounter::Cycles)) {
+            ASSERT_GT(delta.get(skl::EPerfCounter::Cycles), 0U);
+        }
+    } else {
+        //No PMU or not permitted (eg. containers, perf_event_paranoid), only the wall time is valid
+        ASSERT_EQ(status, SKL_ERR_DEVICE);
+        ASSERT_FALSE(counters.is_open());
+        ASSERT_EQ(counters.available_mask(), 0U);
+
+        const auto sample = counters.read();
+        ASSERT_EQ(sample.m_available_mask, 0U);
+        ASSERT_GT(sample.m_time_ns, 0U);
+        ASSERT_EQ(sample.get(skl::EPerfCounter::Cycles), 0U);
+    }
+
+    counters.close();
+    ASSERT_FALSE(counters.is_open());
+    ASSERT_EQ(counters.available_mask(), 0U);
+    counters.close();
+
+    //Can be reopened
+    ASSERT_EQ(counters.open().is_success(), status.is_success());
+}
+
+TEST(SkylakePerfCounters, ScopesRecordIntoThreadBuffer) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    skl::perf_scope_record_t records[16];
+    (void)skl::skl_perf_scope_drain(records, 16U);
+
+    {
+        SKL_PERF_SCOPE("outer");
+        {
+            SKL_PERF_SCOPE("inner_sleep");
+            skl::skl_sleep(2U);
+        }
+        {
+            SKL_PERF_SCOPE("inner_work");
+            (void)busy_work(100'000U);
+        }
+    }
+
+#if SKL_PERF_SCOPES
+    const u32 mask = skl::skl_perf_thread_available_mask();
+
+    //Recorded in completion order
+    ASSERT_EQ(skl::skl_perf_scope_drain(records, 16U), 3U);
+    ASSERT_STREQ(records[0].m_name, "inner_sleep");
+    ASSERT_STREQ(records[1].m_name, "inner_work");
+    ASSERT_STREQ(records[2].m_name, "outer");
+
+    ASSERT_GE(records[0].m_delta.m_time_ns, 2'000'000U);
+    ASSERT_GE(records[2].m_delta.m_time_ns, records[0].m_delta.m_time_ns + records[1].m_delta.m_time_ns);
+    for (u32 i = 0U; i < 3U; ++i) {
+        ASSERT_EQ(records[i].m_delta.m_available_mask & ~mask, 0U);
+    }
+    if (records[1].m_delta.has(skl::EPerfCounter::Instructions)) {
+        ASSERT_GE(records[1].m_delta.get(skl::EPerfCounter::Instructions), 100'000U);
+    }
+#endif
+
+    ASSERT_EQ(skl::skl_perf_scope_drain(records, 16U), 0U);
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakePerfCounters, ScopesOverwriteOldest) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    static constexpr u64 CExtra = 10U;
+
+    std::thread worker{[]() noexcept {
+        ASSERT_TRUE(skl::skl_core_init_thread().is_success());
+
+        const u64 overwritten_before = skl::skl_perf_scope_overwritten_count();
+        ASSERT_EQ(overwritten_before, 0U);
+
+        const auto start = skl::skl_perf_thread_read();
+        for (u64 i = 0U; i < skl::CPerfScopeThreadBufferSize + CExtra; ++i) {
+            skl::skl_perf_scope_record((i < CExtra) ? "old" : "new", start);
+        }
+        ASSERT_EQ(skl::skl_perf_scope_overwritten_count(), CExtra);
+
+        auto records = std::make_unique<skl::perf_scope_record_t[]>(skl::CPerfScopeThreadBufferSize + CExtra);
+        ASSERT_EQ(skl::skl_perf_scope_drain(records.get(), u32(skl::CPerfScopeThreadBufferSize + CExtra)), skl::CPerfScopeThreadBufferSize);
+        for (u64 i = 0U; i < skl::CPerfScopeThreadBufferSize; ++i) {
+            ASSERT_STREQ(records[i].m_name, "new");
+        }
+
+        ASSERT_TRUE(skl::skl_core_deinit_thread().is_success());
+    }};
+    worker.join();
+
+    //Other threads buffers are not visible
+    skl::perf_scope_record_t records[4];
+    ASSERT_EQ(skl::skl_perf_scope_drain(records, 4U), 0U);
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
@@ -0,0 +1,286 @@
+#include <skl_shm_spsc_ring>
+#include <skl_huge_pages>
+
+#include <skl_core>
+
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+struct packet_t {
+    u64 m_sequence;
+    u64 m_payload[7];
+};
+
+struct other_packet_t {
+    u64 m_sequence;
+};
+
+using ring_t = skl::shm_spsc_unidirectional_ring_t<packet_t, 256U>;
+
+//! Unique segment name for this process and test
+void make_name(char (&f_out_name)[64U], const char* f_test) noexcept {
+    (void)std::snprintf(f_out_name, sizeof(f_out_name), "skl-shm-ring-%d-%s", ::getpid(), f_test);
+}
+
+//! Wait for the child, get its exit code
+[[nodiscard]] i32 wait_child(pid_t f_child) noexcept {
+    i32 status = 0;
+    if (f_child != ::waitpid(f_child, &status, 0)) {
+        return -1;
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+} // namespace
+
+TEST(SkylakeShmSPSCRing, CreateAttachChecks) {
+    char name[64U];
+    make_name(name, "checks");
+
+    ring_t producer{};
+    ASSERT_EQ(producer.attach(name, skl::EShmRingRole::Producer), SKL_ERR_NOT_FOUND);
+    ASSERT_EQ(producer.create(name, skl::EShmRingRole::Producer, false), SKL_SUCCESS);
+    ASSERT_TRUE(producer.is_attached());
+    ASSERT_FALSE(producer.is_peer_alive());
+
+    // The name is in use
+    ring_t other{};
+    ASSERT_EQ(other.create(name, skl::EShmRingRole::Consumer, false), SKL_ERR_EXISTING);
+
+    // Layout and role checks
+    skl::shm_spsc_unidirectional_ring_t<other_packet_t, 256U> wrong_object{};
+    ASSERT_EQ(wrong_object.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_SIZE);
+    skl::shm_spsc_unidirectional_ring_t<packet_t, 512U> wrong_size{};
+    ASSERT_EQ(wrong_size.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_SIZE);
+    skl::shm_spsc_bidirectional_ring_t<packet_t, 256U> wrong_kind{};
+    ASSERT_EQ(wrong_kind.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_SIZE);
+    ASSERT_EQ(other.attach(name, skl::EShmRingRole::Producer), SKL_ERR_DUPLICATE);
+    ASSERT_FALSE(other.is_attached());
+
+    ring_t consumer{};
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_SUCCESS);
+    ASSERT_TRUE(producer.is_peer_alive());
+    ASSERT_TRUE(consumer.is_peer_alive());
+
+    // Same segment, mapped at another address
+    auto* packet        = producer.allocate();
+    packet->m_sequence  = 23U;
+    packet->m_payload[0] = 5U;
+    producer.submit();
+
+    packet_t* burst[4U];
+    ASSERT_EQ(consumer.dequeue_burst(burst, 4U), 1U);
+    ASSERT_NE(static_cast<void*>(burst[0U]), static_cast<void*>(packet));
+    ASSERT_EQ(burst[0U]->m_sequence, 23U);
+    consumer.free_processed();
+    ASSERT_EQ(producer.free_count(), ring_t::Size);
+
+    consumer.detach();
+    ASSERT_FALSE(producer.is_peer_alive());
+
+    producer.detach();
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_NOT_FOUND);
+}
+
+TEST(SkylakeShmSPSCRing, CrossProcessStream) {
+    constexpr u64 CCount = 100000U;
+
+    char name[64U];
+    make_name(name, "stream");
+
+    ring_t producer{};
+    ASSERT_EQ(producer.create(name, skl::EShmRingRole::Producer), SKL_SUCCESS);
+
+    const pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (0 == child) {
+        ring_t consumer{};
+        if (consumer.attach(name, skl::EShmRingRole::Consumer).is_failure()) {
+            ::_exit(1);
+        }
+
+        packet_t* burst[32U];
+        u64       expected = 0U;
+        while (expected < CCount) {
+            const u32 count = consumer.dequeue_burst(burst, 32U);
+            for (u32 i = 0U; i < count; ++i) {
+                if ((burst[i]->m_sequence != expected) || (burst[i]->m_payload[6U] != (expected * 3U))) {
+                    ::_exit(2);
+                }
+                ++expected;
+            }
+            consumer.free_processed();
+            if (0U == count) {
+                (void)::sched_yield();
+            }
+        }
+        ::_exit(0);
+    }
+
+    for (u64 i = 0U; i < CCount; ++i) {
+        packet_t* packet = nullptr;
+        while (nullptr == (packet = producer.allocate())) {
+            producer.submit();
+            (void)::sched_yield();
+        }
+        packet->m_sequence    = i;
+        packet->m_payload[6U] = i * 3U;
+        if (0U == (i & 15U)) {
+            producer.submit();
+        }
+    }
+    producer.submit();
+
+    ASSERT_EQ(wait_child(child), 0);
+    ASSERT_FALSE(producer.is_peer_alive());
+}
+
+TEST(SkylakeShmSPSCRing, DeadPeerRecovery) {
+    char name[64U];
+    make_name(name, "recovery");
+
+    ring_t producer{};
+    ASSERT_EQ(producer.create(name, skl::EShmRingRole::Producer), SKL_SUCCESS);
+    for (u64 i = 0U; i < 10U; ++i) {
+        producer.allocate()->m_sequence = i;
+    }
+    producer.submit();
+
+    // The consumer frees 4 objects, processes 3 more then crashes
+    const pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (0 == child) {
+        ring_t consumer{};
+        if (consumer.attach(name, skl::EShmRingRole::Consumer).is_failure()) {
+            ::_exit(1);
+        }
+        packet_t* burst[4U];
+        if (4U != consumer.dequeue_burst(burst, 4U)) {
+            ::_exit(2);
+        }
+        consumer.free_processed();
+        if (3U != consumer.dequeue_burst(burst, 3U)) {
+            ::_exit(3);
+        }
+        ::_exit(0);
+    }
+
+    ASSERT_EQ(wait_child(child), 0);
+    ASSERT_FALSE(producer.is_peer_alive());
+
+    // A new consumer takes over from the last freed object
+    ring_t consumer{};
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_SUCCESS);
+    ASSERT_TRUE(producer.is_peer_alive());
+    ASSERT_EQ(consumer.pending_count(), 6U);
+
+    packet_t* burst[16U];
+    ASSERT_EQ(consumer.dequeue_burst(burst, 16U), 6U);
+    ASSERT_EQ(burst[0U]->m_sequence, 4U);
+    ASSERT_EQ(burst[5U]->m_sequence, 9U);
+}
+
+TEST(SkylakeShmSPSCRing, StaleSegmentIsReplaced) {
+    char name[64U];
+    make_name(name, "stale");
+
+    // The creator dies without detaching, the name is left behind
+    const pid_t child = ::fork();
+    ASSERT_NE(child, -1);
+    if (0 == child) {
+        auto* producer = new ring_t{};
+        ::_exit(producer->create(name, skl::EShmRingRole::Producer).is_success() ? 0 : 1);
+    }
+    ASSERT_EQ(wait_child(child), 0);
+
+    ring_t consumer{};
+    ASSERT_EQ(consumer.create(name, skl::EShmRingRole::Consumer), SKL_SUCCESS);
+    ASSERT_FALSE(consumer.is_peer_alive());
+}
+
+TEST(SkylakeShmSPSCRing, ForeignSegmentIsCorrupt) {
+    char name[64U];
+    make_name(name, "foreign");
+
+    skl::shm_segment_t segment{};
+    ASSERT_EQ(segment.create(name, 4096U, false), SKL_SUCCESS);
+
+    // Zero filled, the creator did not write the header yet
+    ring_t consumer{};
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_STATE);
+
+    // Not a ring segment, the ready word is never checked
+    std::memset(segment.data(), 0xAB, segment.size());
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_ERR_CORRUPT);
+    ASSERT_FALSE(consumer.is_attached());
+}
+
+TEST(SkylakeShmSPSCRing, BidirectionalResults) {
+    using bidirectional_ring_t = skl::shm_spsc_bidirectional_ring_t<packet_t, 8U>;
+
+    char name[64U];
+    make_name(name, "bidirectional");
+
+    bidirectional_ring_t producer{};
+    bidirectional_ring_t consumer{};
+    ASSERT_EQ(producer.create(name, skl::EShmRingRole::Producer), SKL_SUCCESS);
+    ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_SUCCESS);
+
+    for (u64 i = 0U; i < 8U; ++i) {
+        producer.allocate()->m_sequence = i;
+    }
+    ASSERT_EQ(producer.allocate(), nullptr);
+    producer.submit();
+
+    packet_t* burst[8U];
+    ASSERT_EQ(consumer.dequeue_burst(burst, 8U), 8U);
+    for (u32 i = 0U; i < 8U; ++i) {
+        burst[i]->m_payload[0U] = burst[i]->m_sequence * 2U;
+    }
+    consumer.submit_results();
+
+    // Results are not free until collected and submitted back
+    ASSERT_EQ(producer.allocate(), nullptr);
+    ASSERT_EQ(producer.dequeue_results_burst(burst, 8U), 8U);
+    ASSERT_EQ(burst[7U]->m_payload[0U], 14U);
+    producer.submit_processed_results();
+    ASSERT_EQ(producer.free_count(), 8U);
+}
+
+TEST(SkylakeShmSPSCRing, HugePagesBacked) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    if (!skl::huge_pages::is_huge_pages_enabled()) {
+        ASSERT_TRUE(skl::skl_core_deinit().is_success());
+        GTEST_SKIP() << "Hugepages not available";
+    }
+
+    {
+        char name[64U];
+        make_name(name, "huge");
+
+        ring_t producer{};
+        ring_t consumer{};
+        ASSERT_EQ(producer.create(name, skl::EShmRingRole::Producer, true), SKL_SUCCESS);
+        ASSERT_EQ(consumer.attach(name, skl::EShmRingRole::Consumer), SKL_SUCCESS);
+        ASSERT_EQ(producer.is_huge_pages(), consumer.is_huge_pages());
+
+        producer.allocate()->m_sequence = 7U;
+        producer.submit();
+        packet_t* burst[1U];
+        ASSERT_EQ(consumer.dequeue_burst(burst, 1U), 1U);
+        ASSERT_EQ(burst[0U]->m_sequence, 7U);
+
+        // The name is removed together with its backing
+        producer.detach();
+        skl::shm_segment_t segment{};
+        ASSERT_EQ(segment.open(name), SKL_ERR_NOT_FOUND);
+    }
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
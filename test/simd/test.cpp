@@ -0,0 +1,112 @@
+#include <skl_simd>
+#include <skl_dynamic_bitset>
+
+#include <gtest/gtest.h>
+
+namespace {
+using kernel_t = u32 (*)(const u64*, u32, u64) noexcept;
+
+constexpr u32 CMaxWordsCount = 70U;
+
+//! Run \p f_kernel on every size up to CMaxWordsCount with a single mismatch at every position
+void check_kernel_against_scalar(kernel_t f_kernel) noexcept {
+    alignas(64) u64 words[CMaxWordsCount + 1U];
+
+    for (const u64 value : {u64(0U), ~u64(0U), u64(0x00000000FFFFFFFFULL), u64(0xFFFFFFFF00000000ULL)}) {
+        for (u32 count = 0U; count <= CMaxWordsCount; ++count) {
+            for (u32 i = 0U; i <= CMaxWordsCount; ++i) {
+                words[i] = value;
+            }
+            ASSERT_EQ(count, f_kernel(words, count, value));
+
+            for (u32 mismatch = 0U; mismatch < count; ++mismatch) {
+                // Flip one bit in the low and then in the high half (the SSE2 kernel compares 32 bit lanes)
+                for (const u64 flip : {u64(1U) << 3U, u64(1U) << 40U}) {
+                    words[mismatch] = value ^ flip;
+                    ASSERT_EQ(skl::simd::detail::find_first_not_equal_u64_scalar(words, count, value), f_kernel(words, count, value));
+                    ASSERT_EQ(mismatch, f_kernel(words, count, value));
+                    words[mismatch] = value;
+                }
+            }
+
+            // Mismatch past the end is not seen
+            words[count] = ~value;
+            ASSERT_EQ(count, f_kernel(words, count, value));
+            words[count] = value;
+        }
+    }
+}
+
+//! Find first at compile time
+consteval u32 find_first_not_equal_consteval() {
+    const u64 words[5U] = {7U, 7U, 7U, 8U, 7U};
+    return skl::simd::find_first_not_equal_u64(words, 5U, 7U);
+}
+} // namespace
+
+TEST(SkylakeSimd, levels) {
+    ASSERT_LE(skl::simd::active_simd_level(), skl::simd::cpu_simd_level());
+#if SKL_SIMD_RUNTIME_DISPATCH
+    ASSERT_EQ(skl::simd::active_simd_level(), skl::simd::cpu_simd_level());
+#else
+    ASSERT_EQ(skl::simd::active_simd_level(), skl::simd::CCompiledSimdLevel);
+#endif
+}
+
+TEST(SkylakeSimd, find_first_not_equal_u64_constexpr) {
+    static_assert(3U == find_first_not_equal_consteval());
+}
+
+TEST(SkylakeSimd, find_first_not_equal_u64_scalar) {
+    check_kernel_against_scalar([](const u64* f_words, u32 f_count, u64 f_value) noexcept {
+        return skl::simd::detail::find_first_not_equal_u64_scalar(f_words, f_count, f_value);
+    });
+}
+
+TEST(SkylakeSimd, find_first_not_equal_u64_selected) {
+    check_kernel_against_scalar([](const u64* f_words, u32 f_count, u64 f_value) noexcept {
+        return skl::simd::find_first_not_equal_u64(f_words, f_count, f_value);
+    });
+}
+
+#if defined(__x86_64__)
+TEST(SkylakeSimd, find_first_not_equal_u64_x86_kernels) {
+    const auto level = skl::simd::cpu_simd_level();
+
+    if (level >= skl::simd::ESimdLevel::SSE2) {
+        check_kernel_against_scalar(&skl::simd::detail::find_first_not_equal_u64_sse2);
+    }
+    if (level >= skl::simd::ESimdLevel::AVX2) {
+        check_kernel_against_scalar(&skl::simd::detail::find_first_not_equal_u64_avx2);
+    }
+    if (level >= skl::simd::ESimdLevel::AVX512) {
+        check_kernel_against_scalar(&skl::simd::detail::find_first_not_equal_u64_avx512);
+    }
+}
+#endif
+
+TEST(SkylakeSimd, dynamic_bitset_find_first) {
+    // Sizes around the kernels step (2, 4, 8 slices) and with a padded last slice
+    for (const u32 size : {1U, 63U, 64U, 65U, 127U, 128U, 255U, 256U, 511U, 512U, 513U, 1000U, 4096U}) {
+        skl::DynamicBitSet<false> zeros{size};
+        skl::DynamicBitSet<true>  ones{size};
+
+        ASSERT_TRUE(zeros.find_first<true>().is_failure());
+        ASSERT_TRUE(ones.find_first<false>().is_failure());
+
+        for (u32 bit = 0U; bit < size; bit += 7U) {
+            (void)zeros.set(bit);
+            (void)ones.unset(bit);
+
+            const auto first_one  = zeros.find_first<true>();
+            const auto first_zero = ones.find_first<false>();
+            ASSERT_TRUE(first_one.is_success());
+            ASSERT_TRUE(first_zero.is_success());
+            ASSERT_EQ(bit, first_one.value());
+            ASSERT_EQ(bit, first_zero.value());
+
+            (void)zeros.unset(bit);
+            (void)ones.set(bit);
+        }
+    }
+}
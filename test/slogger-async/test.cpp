@@ -0,0 +1,199 @@
+#include <skl_log>
+#include <skl_thread>
+#include <skl_core>
+#include <skl_logger/skl_slogger_sink.hpp>
+#include <skl_logger/skl_slogger_bend.hpp>
+
+#include <pthread.h>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#define SKL_LOG_TAG "[AsyncUT] -- "
+
+namespace {
+struct counting_sink_t final : skl::SLoggerSink {
+    counting_sink_t() noexcept
+        : skl::SLoggerSink(false) { }
+
+    void thread_init() noexcept override {
+        (void)m_thread_inits.increment();
+    }
+    void thread_deinit() noexcept override { }
+    void begin_log(skl::skl_stream&) noexcept override { }
+
+    void end_and_sink_log(skl::skl_stream& f_log_stream) noexcept override {
+        f_log_stream.reset();
+        const auto result = skl::SKLSerializedLoggerBackend::process_no_colors(f_log_stream);
+        if (std::string_view{result.data(), result.length()}.find("async value") != std::string_view::npos) {
+            (void)m_valid.increment();
+        }
+        if (0 == pthread_equal(pthread_self(), m_producer_thread)) {
+            (void)m_off_producer.increment();
+        }
+        (void)m_count.increment();
+    }
+
+    pthread_t               m_producer_thread{};
+    std::relaxed_value<u64> m_count{0U};
+    std::relaxed_value<u64> m_valid{0U};
+    std::relaxed_value<u64> m_off_producer{0U};
+    std::relaxed_value<u32> m_thread_inits{0U};
+};
+
+counting_sink_t g_counting_sink;
+} // namespace
+
+TEST(SkylakeSLoggerAsync, BlockPolicyDeliversAll) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting async logger test");
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::register_custom_sink(&g_counting_sink).is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerCustomSink).is_success());
+
+    g_counting_sink.m_producer_thread = pthread_self();
+
+    skl::slogger_async_config_t config{};
+    config.m_overflow_policy = skl::ESLoggerAsyncOverflowPolicy::Block;
+    ASSERT_TRUE(skl::SLoggerSinkManager::start_async(config).is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::is_async());
+    ASSERT_EQ(skl::SLoggerSinkManager::start_async(config), SKL_OK_REDUNDANT);
+
+    constexpr u64 CLogsCount = 100000U;
+    const auto    before     = skl::SLoggerSinkManager::get_async_stats();
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        SINFO("async value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::stop_async().is_success());
+    ASSERT_FALSE(skl::SLoggerSinkManager::is_async());
+    ASSERT_EQ(skl::SLoggerSinkManager::stop_async(), SKL_OK_REDUNDANT);
+
+    const auto after = skl::SLoggerSinkManager::get_async_stats();
+    ASSERT_EQ(after.m_submitted_count - before.m_submitted_count, CLogsCount);
+    ASSERT_EQ(after.m_processed_count - before.m_processed_count, CLogsCount);
+    ASSERT_EQ(after.m_dropped_count, before.m_dropped_count);
+    ASSERT_EQ(g_counting_sink.m_count.load_acquire(), CLogsCount);
+    ASSERT_EQ(g_counting_sink.m_valid.load_acquire(), CLogsCount);
+    ASSERT_EQ(g_counting_sink.m_off_producer.load_acquire(), CLogsCount);
+
+    //After stop, logs are sunk on the calling thread
+    SINFO("async value {}", 1);
+    ASSERT_EQ(g_counting_sink.m_count.load_acquire(), CLogsCount + 1U);
+    ASSERT_EQ(g_counting_sink.m_off_producer.load_acquire(), CLogsCount);
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakeSLoggerAsync, DropPolicyMultipleProducers) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::register_custom_sink(&g_counting_sink).is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerCustomSink).is_success());
+
+    g_counting_sink.m_count.store_release(0U);
+    g_counting_sink.m_valid.store_release(0U);
+
+    skl::slogger_async_config_t config{};
+    config.m_overflow_policy = skl::ESLoggerAsyncOverflowPolicy::Drop;
+    config.m_idle_sleep_us   = 1000U;
+    ASSERT_TRUE(skl::SLoggerSinkManager::start_async(config).is_success());
+
+    const auto before = skl::SLoggerSinkManager::get_async_stats();
+
+    constexpr u32 CProducersCount = 4U;
+    constexpr u64 CLogsPerThread  = 50000U;
+
+    std::vector<skl::SKLThread> threads;
+    threads.reserve(CProducersCount);
+    for (u32 i = 0U; i < CProducersCount; ++i) {
+        threads.emplace_back();
+        threads.back().set_handler([]() noexcept -> i32 {
+            for (u64 j = 0U; j < CLogsPerThread; ++j) {
+                SINFO("async value {}", j);
+            }
+            return 0;
+        });
+    }
+    for (auto& thread : threads) {
+        ASSERT_TRUE(thread.create().is_success());
+    }
+    for (auto& thread : threads) {
+        ASSERT_TRUE(thread.join().is_success());
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::stop_async().is_success());
+
+    //Exited producers are released
+    const auto after = skl::SLoggerSinkManager::get_async_stats();
+    ASSERT_EQ(after.m_producers_count, before.m_producers_count);
+
+    const u64 submitted = after.m_submitted_count - before.m_submitted_count;
+    const u64 dropped   = after.m_dropped_count - before.m_dropped_count;
+    ASSERT_EQ(submitted + dropped, CProducersCount * CLogsPerThread);
+    ASSERT_EQ(after.m_processed_count - before.m_processed_count, submitted);
+    ASSERT_EQ(g_counting_sink.m_count.load_acquire(), submitted);
+    ASSERT_EQ(g_counting_sink.m_valid.load_acquire(), submitted);
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakeSLoggerAsync, StopWhileLoggingLosesNothing) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::register_custom_sink(&g_counting_sink).is_success());
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerCustomSink).is_success());
+
+    g_counting_sink.m_count.store_release(0U);
+    g_counting_sink.m_valid.store_release(0U);
+
+    skl::slogger_async_config_t config{};
+    config.m_overflow_policy = skl::ESLoggerAsyncOverflowPolicy::Block;
+    ASSERT_TRUE(skl::SLoggerSinkManager::start_async(config).is_success());
+
+    const auto before = skl::SLoggerSinkManager::get_async_stats();
+
+    constexpr u32 CProducersCount = 4U;
+    constexpr u64 CLogsPerThread  = 50000U;
+
+    //The producers keep logging while the back-end is stopped, the records land either in the rings or on the producer threads
+    std::relaxed_value<u32>     started{0U};
+    std::vector<skl::SKLThread> threads;
+    threads.reserve(CProducersCount);
+    for (u32 i = 0U; i < CProducersCount; ++i) {
+        threads.emplace_back();
+        threads.back().set_handler([&started]() noexcept -> i32 {
+            (void)started.increment();
+            for (u64 j = 0U; j < CLogsPerThread; ++j) {
+                SINFO("async value {}", j);
+            }
+            return 0;
+        });
+    }
+    for (auto& thread : threads) {
+        ASSERT_TRUE(thread.create().is_success());
+    }
+    while (CProducersCount != started.load_acquire()) {
+        __builtin_ia32_pause();
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::stop_async().is_success());
+
+    for (auto& thread : threads) {
+        ASSERT_TRUE(thread.join().is_success());
+    }
+
+    const auto after     = skl::SLoggerSinkManager::get_async_stats();
+    const u64  submitted = after.m_submitted_count - before.m_submitted_count;
+    ASSERT_EQ(after.m_dropped_count, before.m_dropped_count);
+    ASSERT_EQ(after.m_processed_count - before.m_processed_count, submitted);
+    ASSERT_EQ(g_counting_sink.m_count.load_acquire(), CProducersCount * CLogsPerThread);
+    ASSERT_EQ(g_counting_sink.m_valid.load_acquire(), CProducersCount * CLogsPerThread);
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+#undef SKL_LOG_TAG
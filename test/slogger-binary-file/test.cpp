@@ -0,0 +1,164 @@
+#include <skl_log>
+#include <skl_core>
+#include <skl_logger/skl_slogger_sink.hpp>
+#include <skl_logger/skl_slogger_binary.hpp>
+
+#include <cstdio>
+#include <string>
+#include <cstring>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <gtest/gtest.h>
+
+#define SKL_LOG_TAG "[BinaryFileUT] -- "
+
+namespace {
+[[nodiscard]] u64 file_size(const std::string& f_path) noexcept {
+    struct stat file_stat{};
+    if (0 != stat(f_path.c_str(), &file_stat)) {
+        return 0U;
+    }
+    return u64(file_stat.st_size);
+}
+
+struct decode_checker_t {
+    u64  m_next      = 0U;
+    bool m_all_match = true;
+
+    void operator()(skl::skl_string_view f_text) noexcept {
+        const std::string expected = std::string("binary value ") + std::to_string(m_next) + " some string arg";
+        m_all_match &= (nullptr != strstr(f_text.data(), expected.c_str()));
+        ++m_next;
+    }
+};
+} // namespace
+
+TEST(SkylakeSLoggerBinaryFile, DecodeMatchesSource) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting binary file test");
+
+    const std::string path = std::string("/tmp/skl_slogger_binary_") + std::to_string(getpid()) + ".slog";
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_format            = skl::ESLoggerFileSinkFormat::Binary;
+    config.m_flush_interval_ms = 10U;
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_success());
+
+    constexpr u64 CLogsCount = 20000U;
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        SINFO("binary value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after = skl::SLoggerSinkManager::get_file_sink_stats();
+    ASSERT_EQ(after.m_records_count - before.m_records_count, CLogsCount);
+    ASSERT_EQ(after.m_dropped_count, before.m_dropped_count);
+    ASSERT_EQ(after.m_interned_count - before.m_interned_count, 2U); //file name + fmt string
+    ASSERT_EQ(file_size(path), after.m_written_bytes - before.m_written_bytes);
+
+    //The file name and fmt string are not repeated per record
+    ASSERT_LT(file_size(path) / CLogsCount, 64U);
+
+    skl::SLoggerBinaryDecoder decoder{};
+    ASSERT_EQ(decoder.open(path.c_str()), SKL_SUCCESS);
+
+    decode_checker_t checker{};
+    const auto       result = decoder.decode<false>(checker);
+    ASSERT_TRUE(result.is_success());
+    ASSERT_EQ(result.value(), CLogsCount);
+    ASSERT_TRUE(checker.m_all_match);
+    ASSERT_EQ(decoder.stats().m_segments_count, 1U);
+    ASSERT_EQ(decoder.stats().m_dictionary_count, 2U);
+    ASSERT_EQ(decoder.stats().m_malformed_count, 0U);
+    decoder.close();
+
+    //Appending starts a new segment
+    config.m_truncate = false;
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_success());
+    SINFO("binary value {} {}", CLogsCount, skl::skl_string_view::exact_cstr("some string arg"));
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    ASSERT_EQ(decoder.open(path.c_str()), SKL_SUCCESS);
+    decode_checker_t append_checker{};
+    const auto       append_result = decoder.decode<false>(append_checker);
+    ASSERT_TRUE(append_result.is_success());
+    ASSERT_EQ(append_result.value(), CLogsCount + 1U);
+    ASSERT_TRUE(append_checker.m_all_match);
+    ASSERT_EQ(decoder.stats().m_segments_count, 2U);
+    decoder.close();
+
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakeSLoggerBinaryFile, RotatedFilesAreSelfContained) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    SINFO_LOCAL("Starting binary file rotation test");
+
+    const std::string path = std::string("/tmp/skl_slogger_binary_rotate_") + std::to_string(getpid()) + ".slog";
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_format            = skl::ESLoggerFileSinkFormat::Binary;
+    config.m_rotate_size_bytes = 64U * 1024U;
+    config.m_flush_interval_ms = 1U;
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_success());
+
+    constexpr u64 CLogsCount = 100000U;
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        SINFO("binary value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after     = skl::SLoggerSinkManager::get_file_sink_stats();
+    const u64  records   = after.m_records_count - before.m_records_count;
+    const u64  rotations = after.m_rotations_count - before.m_rotations_count;
+    ASSERT_EQ(records + (after.m_dropped_count - before.m_dropped_count), CLogsCount);
+    ASSERT_GT(rotations, 0U);
+
+    //Every file starts with its own segment and dictionary
+    u64 decoded = 0U;
+    for (u64 i = 0U; i <= rotations; ++i) {
+        const std::string file = (0U == i) ? path : (path + "." + std::to_string(i));
+
+        skl::SLoggerBinaryDecoder decoder{};
+        ASSERT_EQ(decoder.open(file.c_str()), SKL_SUCCESS) << file;
+
+        u64  count   = 0U;
+        auto counter = [&count](skl::skl_string_view f_text) noexcept {
+            count += (nullptr != strstr(f_text.data(), "binary value ")) ? 1U : 0U;
+        };
+        const auto result = decoder.decode<false>(counter);
+        ASSERT_TRUE(result.is_success()) << file;
+        ASSERT_EQ(decoder.stats().m_segments_count, 1U);
+        ASSERT_EQ(count, result.value());
+        decoded += count;
+
+        decoder.close();
+        (void)unlink(file.c_str());
+    }
+    ASSERT_EQ(decoded, records);
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
@@ -0,0 +1,306 @@
+#include <skl_log>
+#include <skl_core>
+#include <skl_sleep>
+#include <skl_logger/skl_slogger_sink.hpp>
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include <gtest/gtest.h>
+
+#define SKL_LOG_TAG "[FileSinkUT] -- "
+
+namespace {
+[[nodiscard]] u64 count_lines(const char* f_path, u64& f_out_bytes) noexcept {
+    FILE* file = fopen(f_path, "rb");
+    if (nullptr == file) {
+        return 0U;
+    }
+
+    u64 lines = 0U;
+    f_out_bytes = 0U;
+    for (int c = fgetc(file); EOF != c; c = fgetc(file)) {
+        ++f_out_bytes;
+        if ('\n' == c) {
+            ++lines;
+        }
+    }
+    (void)fclose(file);
+    return lines;
+}
+
+void run_file_sink_test(bool f_direct_io) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting file sink test");
+
+    const std::string path = std::string("/tmp/skl_slogger_file_sink_") + std::to_string(getpid()) + (f_direct_io ? "_direct.log" : ".log");
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_use_direct_io     = f_direct_io;
+    config.m_flush_interval_ms = 10U;
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_ERR_STATE);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_success());
+
+    constexpr u64 CLogsCount = 20000U;
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        SINFO("file sink value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_OK_REDUNDANT);
+
+    const auto after   = skl::SLoggerSinkManager::get_file_sink_stats();
+    const u64  records = after.m_records_count - before.m_records_count;
+    ASSERT_EQ(records + (after.m_dropped_count - before.m_dropped_count), CLogsCount);
+    ASSERT_EQ(after.m_write_errors_count, 0U);
+    ASSERT_GT(after.m_flush_count, before.m_flush_count);
+    ASSERT_GE(after.m_flush_latency_total_ns, after.m_flush_latency_max_ns);
+
+    u64       bytes = 0U;
+    const u64 lines = count_lines(path.c_str(), bytes);
+    ASSERT_EQ(lines, records);
+    ASSERT_EQ(bytes, after.m_written_bytes - before.m_written_bytes);
+
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+void run_file_sink_append_test(bool f_direct_io) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    SINFO_LOCAL("Starting file sink append test");
+
+    const std::string path = std::string("/tmp/skl_slogger_file_sink_append_") + std::to_string(getpid()) + (f_direct_io ? "_direct.log" : ".log");
+
+    //Content left by a previous run
+    const std::string previous = "previous run line 1\nprevious run line 2\n";
+    {
+        FILE* file = fopen(path.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fwrite(previous.data(), 1U, previous.size(), file), previous.size());
+        (void)fclose(file);
+    }
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = false;
+    config.m_use_direct_io     = f_direct_io;
+    config.m_flush_interval_ms = 10U;
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    for (u64 i = 0U; i < 1000U; ++i) {
+        SINFO_SPECIFIC(skl::CSLoggerFileSinkId, "append value {}", i);
+    }
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after   = skl::SLoggerSinkManager::get_file_sink_stats();
+    const u64  records = after.m_records_count - before.m_records_count;
+    ASSERT_GT(records, 0U);
+    ASSERT_EQ(after.m_write_errors_count, before.m_write_errors_count);
+
+    //The previous content is kept and the new records follow it
+    u64       bytes = 0U;
+    const u64 lines = count_lines(path.c_str(), bytes);
+    ASSERT_EQ(lines, records + 2U);
+    ASSERT_EQ(bytes, previous.size() + (after.m_written_bytes - before.m_written_bytes));
+
+    char  head[64U]{};
+    FILE* file = fopen(path.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fread(head, 1U, previous.size(), file), previous.size());
+    (void)fclose(file);
+    ASSERT_EQ(std::string(head, previous.size()), previous);
+
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+void write_file(const std::string& f_path, const std::string& f_content) {
+    FILE* file = fopen(f_path.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(f_content.data(), 1U, f_content.size(), file), f_content.size());
+    (void)fclose(file);
+}
+
+[[nodiscard]] std::string read_file(const std::string& f_path) {
+    std::string result;
+    FILE*       file = fopen(f_path.c_str(), "rb");
+    if (nullptr == file) {
+        return result;
+    }
+    for (int c = fgetc(file); EOF != c; c = fgetc(file)) {
+        result.push_back(char(c));
+    }
+    (void)fclose(file);
+    return result;
+}
+} // namespace
+
+TEST(SkylakeSLoggerFileSink, Buffered) {
+    run_file_sink_test(false);
+}
+
+TEST(SkylakeSLoggerFileSink, DirectIO) {
+    run_file_sink_test(true);
+}
+
+TEST(SkylakeSLoggerFileSink, RotateBySize) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    SINFO_LOCAL("Starting file sink rotation test");
+
+    const std::string path = std::string("/tmp/skl_slogger_file_sink_rotate_") + std::to_string(getpid()) + ".log";
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_rotate_size_bytes = 64U * 1024U;
+    config.m_flush_interval_ms = 1U;
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+    for (u64 i = 0U; i < 3000U; ++i) {
+        SINFO_SPECIFIC(skl::CSLoggerFileSinkId, "rotate value {}", i);
+        if (0U == (i % 500U)) {
+            skl::skl_sleep(5U);
+        }
+    }
+
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after = skl::SLoggerSinkManager::get_file_sink_stats();
+    ASSERT_GT(after.m_rotations_count, before.m_rotations_count);
+
+    u64 total_lines = 0U;
+    u64 bytes       = 0U;
+    total_lines += count_lines(path.c_str(), bytes);
+    for (u64 i = 1U; i <= (after.m_rotations_count - before.m_rotations_count); ++i) {
+        const std::string rotated = path + "." + std::to_string(i);
+        total_lines += count_lines(rotated.c_str(), bytes);
+        (void)unlink(rotated.c_str());
+    }
+    ASSERT_EQ(total_lines, after.m_records_count - before.m_records_count);
+
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakeSLoggerFileSink, AppendBuffered) {
+    run_file_sink_append_test(false);
+}
+
+TEST(SkylakeSLoggerFileSink, AppendDirectIO) {
+    run_file_sink_append_test(true);
+}
+
+TEST(SkylakeSLoggerFileSink, RotationContinuesExistingNumbering) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    SINFO_LOCAL("Starting file sink rotation numbering test");
+
+    const std::string path = std::string("/tmp/skl_slogger_file_sink_renumber_") + std::to_string(getpid()) + ".log";
+
+    //Rotated files left by a previous run
+    write_file(path + ".1", "previous run 1\n");
+    write_file(path + ".2", "previous run 2\n");
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_rotate_size_bytes = 64U * 1024U;
+    config.m_flush_interval_ms = 1U;
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+    for (u64 i = 0U; i < 3000U; ++i) {
+        SINFO_SPECIFIC(skl::CSLoggerFileSinkId, "renumber value {}", i);
+        if (0U == (i % 500U)) {
+            skl::skl_sleep(5U);
+        }
+    }
+
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after     = skl::SLoggerSinkManager::get_file_sink_stats();
+    const u64  rotations = after.m_rotations_count - before.m_rotations_count;
+    ASSERT_GT(rotations, 0U);
+
+    //The previous rotated files are not overwritten
+    ASSERT_EQ(read_file(path + ".1"), "previous run 1\n");
+    ASSERT_EQ(read_file(path + ".2"), "previous run 2\n");
+
+    u64 total_lines = 0U;
+    u64 bytes       = 0U;
+    total_lines += count_lines(path.c_str(), bytes);
+    for (u64 i = 3U; i < (3U + rotations); ++i) {
+        const std::string rotated = path + "." + std::to_string(i);
+        total_lines += count_lines(rotated.c_str(), bytes);
+        (void)unlink(rotated.c_str());
+    }
+    ASSERT_EQ(total_lines, after.m_records_count - before.m_records_count);
+
+    (void)unlink((path + ".1").c_str());
+    (void)unlink((path + ".2").c_str());
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+TEST(SkylakeSLoggerFileSink, FailedRotationKeepsContent) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    SINFO_LOCAL("Starting file sink failed rotation test");
+
+    const std::string path = std::string("/tmp/skl_slogger_file_sink_norotate_") + std::to_string(getpid()) + ".log";
+
+    //A directory in the place of the first rotated file makes rename() fail
+    const std::string blocker = path + ".1";
+    ASSERT_EQ(mkdir(blocker.c_str(), 0755), 0);
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_rotate_size_bytes = 16U * 1024U;
+    config.m_flush_interval_ms = 1U;
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+
+    const auto before = skl::SLoggerSinkManager::get_file_sink_stats();
+    for (u64 i = 0U; i < 3000U; ++i) {
+        SINFO_SPECIFIC(skl::CSLoggerFileSinkId, "no rotate value {}", i);
+        if (0U == (i % 500U)) {
+            skl::skl_sleep(5U);
+        }
+    }
+
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto after = skl::SLoggerSinkManager::get_file_sink_stats();
+    ASSERT_EQ(after.m_rotations_count, before.m_rotations_count);
+    ASSERT_GT(after.m_write_errors_count, before.m_write_errors_count);
+
+    //All records are still in the live file
+    u64       bytes = 0U;
+    const u64 lines = count_lines(path.c_str(), bytes);
+    ASSERT_EQ(lines, after.m_records_count - before.m_records_count);
+    ASSERT_EQ(bytes, after.m_written_bytes - before.m_written_bytes);
+    ASSERT_GT(bytes, config.m_rotate_size_bytes);
+
+    (void)rmdir(blocker.c_str());
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+#undef SKL_LOG_TAG
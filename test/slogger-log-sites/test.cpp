@@ -0,0 +1,100 @@
+#include <skl_log>
+#include <skl_core>
+#include <skl_logger/skl_slogger_sink.hpp>
+
+#include <cstdio>
+#include <string>
+#include <cstring>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#define SKL_LOG_TAG "[LogSitesUT] -- "
+
+namespace {
+[[nodiscard]] std::string read_file(const std::string& f_path) noexcept {
+    std::string content;
+    FILE*       file = fopen(f_path.c_str(), "rb");
+    if (nullptr == file) {
+        return content;
+    }
+    for (int c = fgetc(file); EOF != c; c = fgetc(file)) {
+        content.push_back(char(c));
+    }
+    (void)fclose(file);
+    return content;
+}
+
+[[nodiscard]] u64 count_occurrences(const std::string& f_text, const std::string& f_what) noexcept {
+    u64 count = 0U;
+    for (auto pos = f_text.find(f_what); std::string::npos != pos; pos = f_text.find(f_what, pos + f_what.length())) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+TEST(SkylakeSLoggerLogSites, Registry) {
+    std::relaxed_value<skl::slogger_site_id_t> slot{skl::CSLoggerNoSiteId};
+
+    const auto file_name  = skl::skl_string_view::exact_cstr("some_file.cpp");
+    const auto fmt_string = skl::skl_string_view::exact_cstr("some fmt {}");
+
+    const auto site_id = skl::skl_register_log_site(slot, 42U, file_name, fmt_string);
+    ASSERT_NE(site_id, skl::CSLoggerNoSiteId);
+    ASSERT_NE(site_id, skl::CSLoggerInlineSiteId);
+    ASSERT_EQ(slot.load_acquire(), site_id);
+
+    //Registered once
+    ASSERT_EQ(skl::skl_register_log_site(slot, 42U, file_name, fmt_string), site_id);
+
+    const auto* site = skl::skl_get_log_site(site_id);
+    ASSERT_NE(site, nullptr);
+    ASSERT_EQ(site->m_line_number, 42U);
+    ASSERT_EQ(site->m_file_name.data(), file_name.data());
+    ASSERT_EQ(site->m_fmt_string.data(), fmt_string.data());
+
+    ASSERT_EQ(skl::skl_get_log_site(skl::CSLoggerNoSiteId), nullptr);
+    ASSERT_EQ(skl::skl_get_log_site(skl::CSLoggerInlineSiteId), nullptr);
+}
+
+TEST(SkylakeSLoggerLogSites, SitesResolveToTheirLine) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting log sites test");
+
+    const std::string path = std::string("/tmp/skl_slogger_log_sites_") + std::to_string(getpid()) + ".log";
+
+    skl::slogger_file_sink_config_t config{};
+    config.m_file_path         = path.c_str();
+    config.m_truncate          = true;
+    config.m_flush_interval_ms = 10U;
+
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_file_sink(config), SKL_SUCCESS);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileSinkId).is_success());
+
+    //Same fmt string on different lines, each call site has its own id
+    constexpr u64 CLogsCount = 1000U;
+    u64           first_line  = 0U;
+    u64           second_line = 0U;
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        first_line = __LINE__ + 1U;
+        SINFO("site value {}", i);
+        second_line = __LINE__ + 1U;
+        SWARNING("site value {}", i);
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_file_sink(), SKL_SUCCESS);
+
+    const auto content = read_file(path);
+    ASSERT_EQ(count_occurrences(content, std::string("[test.cpp:") + std::to_string(first_line) + "] -- site value "), CLogsCount);
+    ASSERT_EQ(count_occurrences(content, std::string("[test.cpp:") + std::to_string(second_line) + "] -- site value "), CLogsCount);
+    ASSERT_EQ(count_occurrences(content, "[INFO   ]"), CLogsCount);
+    ASSERT_EQ(count_occurrences(content, "[WARNING]"), CLogsCount);
+    ASSERT_NE(content.find("site value 999"), std::string::npos);
+
+    (void)unlink(path.c_str());
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
@@ -0,0 +1,73 @@
+#include <skl_log>
+#include <skl_core>
+#include <skl_epoch>
+#include <skl_logger/skl_slogger_net.hpp>
+#include <skl_logger/skl_slogger_sink.hpp>
+
+#include <string>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#define SKL_LOG_TAG "[NetSinkUT] -- "
+
+TEST(SkylakeSLoggerNetSink, CollectorDecodesRecords) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    //First log on the thread sets up the default sink
+    SINFO_LOCAL("Starting network sink test");
+
+    skl::SLoggerNetCollector collector{};
+    ASSERT_EQ(collector.open(skl::CIpLoopback, 0U), SKL_SUCCESS);
+    ASSERT_EQ(collector.open(skl::CIpLoopback, 0U), SKL_ERR_STATE);
+    ASSERT_NE(collector.port(), 0U);
+
+    skl::slogger_net_sink_config_t config{};
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_network_sink(config), SKL_ERR_PARAMS);
+
+    config.m_port = collector.port();
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_network_sink(config), SKL_SUCCESS);
+    ASSERT_EQ(skl::SLoggerSinkManager::setup_network_sink(config), SKL_ERR_STATE);
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerNetSinkId).is_success());
+
+    //Keep the burst under the default socket receive buffer size
+    constexpr u64 CLogsCount = 500U;
+    for (u64 i = 0U; i < CLogsCount; ++i) {
+        SINFO("net sink value {} {}", i, skl::skl_string_view::exact_cstr("some string arg"));
+    }
+
+    ASSERT_TRUE(skl::SLoggerSinkManager::set_current_sink(skl::CSLoggerFileHandleSinkId).is_success());
+    ASSERT_EQ(skl::SLoggerSinkManager::close_network_sink(), SKL_SUCCESS);
+    ASSERT_EQ(skl::SLoggerSinkManager::close_network_sink(), SKL_OK_REDUNDANT);
+
+    const auto stats = skl::SLoggerSinkManager::get_network_sink_stats();
+    ASSERT_EQ(stats.m_records_count + stats.m_dropped_count, CLogsCount);
+    ASSERT_EQ(stats.m_send_errors, 0U);
+    ASSERT_GT(stats.m_datagrams_count, 0U);
+    ASSERT_LE(stats.m_send_calls, stats.m_datagrams_count);
+
+    u64  received  = 0U;
+    bool all_match = true;
+    auto on_record = [&](skl::skl_string_view f_text) noexcept {
+        const std::string expected = std::string("net sink value ") + std::to_string(received) + " some string arg";
+        all_match &= (nullptr != strstr(f_text.data(), expected.c_str()));
+        ++received;
+    };
+
+    const auto deadline = skl::get_current_epoch_time() + 5000U;
+    while ((received < stats.m_records_count) && (skl::get_current_epoch_time() < deadline)) {
+        ASSERT_TRUE(collector.poll<false>(100U, on_record).is_success());
+    }
+
+    ASSERT_EQ(received, stats.m_records_count);
+    ASSERT_TRUE(all_match);
+    ASSERT_EQ(collector.stats().m_datagrams_count, stats.m_datagrams_count);
+    ASSERT_EQ(collector.stats().m_lost_datagrams_count, 0U);
+    ASSERT_EQ(collector.stats().m_malformed_count, 0U);
+    ASSERT_EQ(collector.stats().m_bytes_count, stats.m_sent_bytes);
+
+    collector.close();
+    ASSERT_FALSE(collector.is_open());
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
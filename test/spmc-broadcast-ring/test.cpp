@@ -0,0 +1,192 @@
+#include <skl_spmc_broadcast_ring>
+#include <skl_huge_pages>
+
+#include <skl_core>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <memory>
+#include <vector>
+
+namespace {
+struct event_t {
+    u64 m_sequence;
+    u64 m_payload;
+};
+
+struct sum_functor_t {
+    static inline u64 sum = 0U;
+
+    static void operator()(const event_t& f_event) noexcept {
+        sum += f_event.m_sequence;
+    }
+};
+} // namespace
+
+TEST(SkylakeSPMCBroadcastRing, EveryConsumerSeesEveryObject) {
+    using ring_t = skl::spmc_broadcast_ring_t<event_t, 16U, 4U, false>;
+    auto ring    = std::make_unique<ring_t>();
+
+    const auto first  = ring->add_consumer();
+    const auto second = ring->add_consumer();
+    ASSERT_NE(first, ring_t::CInvalidConsumer);
+    ASSERT_NE(second, ring_t::CInvalidConsumer);
+    ASSERT_NE(first, second);
+    ASSERT_EQ(ring->consumers_count(), 2U);
+
+    for (u64 i = 0U; i < 10U; ++i) {
+        ring->allocate_checked().m_sequence = i;
+    }
+    ring->submit();
+
+    const event_t* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(first, burst, 16U), 10U);
+    for (u64 i = 0U; i < 10U; ++i) {
+        ASSERT_EQ(burst[i]->m_sequence, i);
+    }
+    ring->free_processed(first);
+
+    // Read in place, same objects
+    const event_t* second_burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(second, second_burst, 4U), 4U);
+    ASSERT_EQ(second_burst[0U], burst[0U]);
+    ASSERT_EQ(ring->pending_count(second), 6U);
+    ASSERT_EQ(ring->processed_count(second), 4U);
+
+    ASSERT_EQ(ring->process_bulk<sum_functor_t>(second, 16U), 6U);
+    ASSERT_EQ(sum_functor_t::sum, 4U + 5U + 6U + 7U + 8U + 9U);
+    ring->free_processed(second);
+    ASSERT_EQ(ring->free_count(), 16U);
+}
+
+TEST(SkylakeSPMCBroadcastRing, SlowestConsumerGatesTheProducer) {
+    using ring_t = skl::spmc_broadcast_ring_t<event_t, 8U, 2U, false>;
+    auto ring    = std::make_unique<ring_t>();
+
+    const auto fast = ring->add_consumer();
+    const auto slow = ring->add_consumer();
+    ASSERT_EQ(ring->add_consumer(), ring_t::CInvalidConsumer);
+
+    event_t* objects[8U];
+    ASSERT_TRUE(ring->allocate_bulk(objects, 8U));
+    for (u64 i = 0U; i < 8U; ++i) {
+        objects[i]->m_sequence = i;
+    }
+    ring->submit();
+    ASSERT_EQ(ring->allocate(), nullptr);
+
+    const event_t* burst[8U];
+    ASSERT_EQ(ring->dequeue_burst(fast, burst, 8U), 8U);
+    ring->free_processed(fast);
+
+    // The slow consumer did not free anything yet
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ASSERT_EQ(ring->free_count(), 0U);
+
+    ASSERT_EQ(ring->dequeue_burst(slow, burst, 3U), 3U);
+    ring->free_processed(slow);
+    ASSERT_EQ(ring->free_count(), 3U);
+    ASSERT_FALSE(ring->allocate_bulk(objects, 4U));
+    ASSERT_TRUE(ring->allocate_bulk(objects, 3U));
+    ring->submit();
+
+    // Removed consumers no longer gate the producer
+    ring->remove_consumer(slow);
+    ASSERT_EQ(ring->consumers_count(), 1U);
+    ASSERT_EQ(ring->free_count(), 5U);
+    ASSERT_EQ(ring->dequeue_burst(fast, burst, 8U), 3U);
+    ring->free_processed(fast);
+    ASSERT_EQ(ring->free_count(), 8U);
+}
+
+TEST(SkylakeSPMCBroadcastRing, ConcurrentConsumers) {
+    constexpr u32 CConsumers = 4U;
+    constexpr u64 CEvents    = 200000U;
+
+    using ring_t = skl::spmc_broadcast_ring_t<event_t, 256U, CConsumers, false>;
+    auto ring    = std::make_unique<ring_t>();
+
+    skl::spmc_consumer_id_t ids[CConsumers];
+    for (auto& id : ids) {
+        id = ring->add_consumer();
+        ASSERT_NE(id, ring_t::CInvalidConsumer);
+    }
+
+    std::vector<u64>         sums(CConsumers, 0U);
+    std::vector<std::thread> consumers;
+    for (u32 c = 0U; c < CConsumers; ++c) {
+        consumers.emplace_back([&ring, &sums, &ids, c]() noexcept {
+            const event_t* burst[32U];
+            u64            expected = 0U;
+            while (expected < CEvents) {
+                const u32 count = ring->dequeue_burst(ids[c], burst, 32U);
+                for (u32 i = 0U; i < count; ++i) {
+                    // In order, no gaps, payload written before submit
+                    ASSERT_EQ(burst[i]->m_sequence, expected);
+                    ASSERT_EQ(burst[i]->m_payload, expected * 3U);
+                    sums[c] += burst[i]->m_sequence;
+                    ++expected;
+                }
+                ring->free_processed(ids[c]);
+                if (0U == count) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (u64 i = 0U; i < CEvents; ++i) {
+        event_t* event = nullptr;
+        while (nullptr == (event = ring->allocate())) {
+            ring->submit();
+            std::this_thread::yield();
+        }
+        event->m_sequence = i;
+        event->m_payload  = i * 3U;
+        if (0U == (i & 15U)) {
+            ring->submit();
+        }
+    }
+    ring->submit();
+
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    for (u32 c = 0U; c < CConsumers; ++c) {
+        ASSERT_EQ(sums[c], (CEvents * (CEvents - 1U)) / 2U);
+    }
+    ASSERT_EQ(ring->free_count(), 256U);
+}
+
+TEST(SkylakeSPMCBroadcastRing, HugePagesStorage) {
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    if (!skl::huge_pages::is_huge_pages_enabled()) {
+        ASSERT_TRUE(skl::skl_core_deinit().is_success());
+        GTEST_SKIP() << "Hugepages not available";
+    }
+
+    {
+        skl::spmc_broadcast_ring_t<event_t, 1024U, 2U, true> ring{};
+        ASSERT_FALSE(ring.has_internal_storage());
+        ring.allocate_internal_storage();
+        ASSERT_TRUE(ring.has_internal_storage());
+
+        const auto consumer = ring.add_consumer();
+        for (u64 i = 0U; i < 1024U; ++i) {
+            ring.allocate_checked().m_sequence = i;
+        }
+        ring.submit();
+        ASSERT_EQ(ring.allocate(), nullptr);
+
+        const event_t* burst[1024U];
+        ASSERT_EQ(ring.dequeue_burst(consumer, burst, 1024U), 1024U);
+        ASSERT_EQ(burst[1023U]->m_sequence, 1023U);
+        ring.free_processed(consumer);
+        ASSERT_EQ(ring.free_count(), 1024U);
+    }
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
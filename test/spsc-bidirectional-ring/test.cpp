@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
+
 namespace {
 struct my_object_t {
     u64  numbers[64U];
@@ -154,6 +156,45 @@ TEST(SkylakeSPSCBidirectionalRing, General) {
     ASSERT_TRUE(skl::skl_core_deinit().is_success());
 }
 
+// Test: The consumer only reloads the queue head when the ring looks empty and
+//       the producer only reloads the queue tail when it has no results left to collect
+TEST(SkylakeSPSCBidirectionalRing, CachedIndices) {
+    using ring_t = skl::spsc_bidirectional_ring_t<u64, 8U, false>;
+    auto ring    = std::make_unique<ring_t>();
+
+    for (u64 i = 0U; i < 4U; ++i) {
+        ring->allocate_checked() = i;
+    }
+    ring->submit();
+
+    u64* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 1U), 1U);
+    ring->submit_results();
+
+    for (u64 i = 4U; i < 6U; ++i) {
+        ring->allocate_checked() = i;
+    }
+    ring->submit();
+
+    // Consumer: the cached objects first, then the reload
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 3U);
+    ASSERT_EQ(*burst[2U], 3U);
+    ring->submit_results();
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 2U);
+    ASSERT_EQ(*burst[1U], 5U);
+
+    // Producer: same for the results
+    u64* results[16U];
+    ASSERT_EQ(ring->dequeue_results_burst(results, 16U), 4U);
+    ring->submit_results();
+    ASSERT_EQ(ring->dequeue_results_burst(results, 16U), 2U);
+    ASSERT_EQ(*results[1U], 5U);
+    ASSERT_EQ(ring->dequeue_results_burst(results, 16U), 0U);
+
+    ring->submit_processed_results();
+    ASSERT_EQ(ring->free_count(), 8U);
+}
+
 // =============================================================================
 // Hugepage Memory Management Tests
 // =============================================================================
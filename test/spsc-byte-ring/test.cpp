@@ -0,0 +1,157 @@
+#include <skl_spsc_byte_ring>
+#include <skl_stream>
+
+#include <skl_core>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <thread>
+#include <memory>
+
+namespace {
+constexpr u64 CRingSize = 64U * 1024U;
+
+//! Deterministic size of the \p f_index record
+[[nodiscard]] u32 record_size_of(u64 f_index) noexcept {
+    return u32(1U + ((f_index * 7919U) % 3000U));
+}
+} // namespace
+
+TEST(SkylakeSPSCByteRing, CreateValidatesTheSize) {
+    skl::spsc_byte_ring_t ring{};
+    ASSERT_FALSE(ring.is_valid());
+    ASSERT_EQ(ring.create(0U), SKL_ERR_PARAMS);
+    ASSERT_EQ(ring.create(3U * 4096U), SKL_ERR_PARAMS);
+    ASSERT_EQ(ring.create(64U), SKL_ERR_PARAMS);
+
+    ASSERT_EQ(ring.create(CRingSize), SKL_SUCCESS);
+    ASSERT_TRUE(ring.is_valid());
+    ASSERT_EQ(ring.size(), CRingSize);
+    ASSERT_EQ(ring.max_record_size(), CRingSize - skl::spsc_byte_ring_t::CRecordHeaderSize);
+    ASSERT_EQ(ring.create(CRingSize), SKL_ERR_STATE);
+
+    ring.destroy();
+    ASSERT_FALSE(ring.is_valid());
+}
+
+TEST(SkylakeSPSCByteRing, RecordsAreContiguousAcrossTheEnd) {
+    skl::spsc_byte_ring_t ring{};
+    ASSERT_EQ(ring.create(CRingSize), SKL_SUCCESS);
+
+    // Move the heads close to the end of the region
+    constexpr u32 CFirstSize = u32(CRingSize - 1024U - skl::spsc_byte_ring_t::CRecordHeaderSize);
+    auto          view       = ring.reserve(CFirstSize);
+    ASSERT_TRUE(view.is_valid());
+    ring.commit(CFirstSize);
+    ASSERT_TRUE(ring.peek().is_valid());
+    ring.release();
+
+    // This record starts 1024 bytes before the end of the region and ends in its beginning
+    constexpr u32 CSize = 8000U;
+    view                = ring.reserve(CSize);
+    ASSERT_TRUE(view.is_valid());
+    for (u32 i = 0U; i < CSize; ++i) {
+        view.buffer[i] = byte(i);
+    }
+    ring.commit(CSize);
+
+    const auto record = ring.peek();
+    ASSERT_TRUE(record.is_valid());
+    ASSERT_EQ(record.length, CSize);
+    ASSERT_EQ(record.buffer, view.buffer);
+    for (u32 i = 0U; i < CSize; ++i) {
+        ASSERT_EQ(record.buffer[i], byte(i));
+    }
+    ASSERT_FALSE(ring.peek().is_valid());
+    ring.release();
+    ASSERT_EQ(ring.free_count(), CRingSize);
+}
+
+TEST(SkylakeSPSCByteRing, ReserveCommitPeekRelease) {
+    skl::spsc_byte_ring_t ring{};
+    ASSERT_EQ(ring.create(CRingSize), SKL_SUCCESS);
+
+    // Reserve more than is written, commit the written size via the stream
+    auto view = ring.reserve(256U);
+    ASSERT_TRUE(view.is_valid());
+    auto& stream = skl::skl_stream::make(view);
+    stream.write(u64(0xDEADBEEFULL));
+    stream.write(u32(23U));
+    ring.commit(stream);
+
+    // Cancelled reservations are not visible
+    ASSERT_TRUE(ring.reserve(64U).is_valid());
+    ring.cancel();
+
+    view = ring.reserve(3U);
+    ASSERT_TRUE(view.is_valid());
+    std::memcpy(view.buffer, "abc", 3U);
+    ring.commit(3U);
+
+    auto first = ring.peek();
+    ASSERT_TRUE(first.is_valid());
+    ASSERT_EQ(first.length, sizeof(u64) + sizeof(u32));
+    auto& reader = skl::skl_stream::make(first);
+    ASSERT_EQ(reader.read<u64>(), 0xDEADBEEFULL);
+    ASSERT_EQ(reader.read<u32>(), 23U);
+
+    const auto second = ring.peek();
+    ASSERT_TRUE(second.is_valid());
+    ASSERT_EQ(second.length, 3U);
+    ASSERT_EQ(0, std::memcmp(second.buffer, "abc", 3U));
+
+    ASSERT_FALSE(ring.peek().is_valid());
+    ASSERT_EQ(ring.pending_bytes(), 0U);
+
+    // Not released yet
+    ASSERT_EQ(ring.free_count(), CRingSize - 24U - 16U);
+    ring.release();
+    ASSERT_EQ(ring.free_count(), CRingSize);
+
+    // Full
+    ASSERT_TRUE(ring.reserve(ring.max_record_size()).is_valid());
+    ring.commit(ring.max_record_size());
+    ASSERT_FALSE(ring.reserve(1U).is_valid());
+}
+
+TEST(SkylakeSPSCByteRing, ProducerConsumerThreads) {
+    constexpr u64 CRecords = 200000U;
+
+    auto ring = std::make_unique<skl::spsc_byte_ring_t>();
+    ASSERT_EQ(ring->create(CRingSize), SKL_SUCCESS);
+
+    std::thread consumer{[&ring]() noexcept {
+        u64 index = 0U;
+        while (index < CRecords) {
+            const u64 before = index;
+            for (auto record = ring->peek(); record.is_valid(); record = ring->peek()) {
+                ASSERT_EQ(record.length, record_size_of(index));
+                ASSERT_EQ(record.buffer[0U], byte(index));
+                if (1U < record.length) {
+                    ASSERT_EQ(record.buffer[record.length - 1U], byte(index >> 8U));
+                }
+                ++index;
+            }
+            ring->release();
+            if (before == index) {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    for (u64 i = 0U; i < CRecords; ++i) {
+        const u32 size = record_size_of(i);
+
+        skl::skl_buffer_view view{};
+        while (false == (view = ring->reserve(size)).is_valid()) {
+            std::this_thread::yield();
+        }
+
+        view.buffer[size - 1U] = byte(i >> 8U);
+        view.buffer[0U]        = byte(i);
+        ring->commit(size);
+    }
+
+    consumer.join();
+}
@@ -1,4 +1,5 @@
 #include <skl_spsc_unidirectional_ring>
+#include <skl_spsc_ring>
 #include <skl_huge_pages>
 
 #include <skl_thread>
@@ -9,6 +10,11 @@
 
 #include <gtest/gtest.h>
 
+#include <poll.h>
+
+#include <thread>
+#include <memory>
+
 namespace {
 struct my_object_t {
     u64  numbers[64U];
@@ -297,3 +303,155 @@ TEST_F(SPSCUnidirectionalRingHugepageTest, FallbackMode) {
     ASSERT_EQ(ring.dequeue_burst(dequeued, 1), 1u);
     ASSERT_EQ(*dequeued[0], 42u);
 }
+
+// =============================================================================
+// Cached Remote Index Tests
+// =============================================================================
+
+// Test: The producer only reloads the queue tail when the ring looks full and
+//       the consumer only reloads the queue head when the ring looks empty
+TEST(SkylakeSPSCUnidirectionalRing, CachedIndices) {
+    using ring_t = skl::spsc_unidirectional_ring_t<u64, 8U, false>;
+    auto ring    = std::make_unique<ring_t>();
+
+    for (u64 i = 0U; i < 8U; ++i) {
+        ring->allocate_checked() = i;
+    }
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ring->submit();
+
+    u64* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 3U), 3U);
+    ring->free_processed();
+
+    // The cached tail says full, the allocation reloads it
+    u64* objects[4U];
+    ASSERT_FALSE(ring->allocate_bulk(objects, 4U));
+    ASSERT_TRUE(ring->allocate_bulk(objects, 3U));
+    for (u64 i = 0U; i < 3U; ++i) {
+        *objects[i] = 8U + i;
+    }
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ring->submit();
+
+    // The consumer drains what it last saw before reloading the head
+    ASSERT_EQ(ring->pending_count(), 8U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 5U);
+    ASSERT_EQ(*burst[4U], 7U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 3U);
+    ASSERT_EQ(*burst[2U], 10U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 0U);
+    ring->free_processed();
+    ASSERT_EQ(ring->free_count(), 8U);
+}
+
+// Test: Same for the spsc_ring_t
+TEST(SkylakeSPSCRing, CachedIndices) {
+    using ring_t = spsc_ring_t<u64, 8U>;
+    auto ring    = std::make_unique<ring_t>();
+
+    for (u64 i = 0U; i < 8U; ++i) {
+        ring->allocate_checked() = i;
+    }
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ring->submit();
+
+    u64* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 2U), 2U);
+    ring->free_processed();
+
+    ASSERT_NE(ring->allocate(), nullptr);
+    ASSERT_NE(ring->allocate(), nullptr);
+    ASSERT_EQ(ring->allocate(), nullptr);
+    ring->submit();
+
+    u32 remaining = 0U;
+    ASSERT_EQ(ring->dequeue_burst_hint(burst, 4U, remaining), 4U);
+    ASSERT_EQ(remaining, 2U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 2U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 2U);
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 0U);
+    ring->free_processed();
+    ASSERT_EQ(ring->free_count(), 8U);
+}
+
+// =============================================================================
+// Consumer Park/Notify Tests
+// =============================================================================
+
+// Test: The consumer parks on the futex when the ring stays empty, submit() wakes it up
+TEST(SkylakeSPSCUnidirectionalRing, FutexNotifier) {
+    using ring_t = skl::spsc_unidirectional_ring_t<u64, 64U, false, skl::ring_futex_notifier_t>;
+    auto ring    = std::make_unique<ring_t>();
+
+    // Nothing submitted, times out
+    u64* burst[16U];
+    ASSERT_EQ(ring->wait_dequeue_burst(burst, 16U, 8U, 5U), 0U);
+
+    constexpr u64 CCount = 20000U;
+
+    std::thread consumer{[&ring]() noexcept {
+        u64* objects[16U];
+        u64  expected = 0U;
+        while (expected < CCount) {
+            const u32 count = ring->wait_dequeue_burst(objects, 16U, 64U);
+            for (u32 i = 0U; i < count; ++i) {
+                ASSERT_EQ(*objects[i], expected);
+                ++expected;
+            }
+            ring->free_processed();
+        }
+    }};
+
+    for (u64 i = 0U; i < CCount; ++i) {
+        u64* object = nullptr;
+        while (nullptr == (object = ring->allocate())) {
+            std::this_thread::yield();
+        }
+        *object = i;
+        ring->submit();
+
+        // Let the consumer park from time to time
+        if (0U == (i % 1000U)) {
+            skl::skl_sleep(1U);
+        }
+    }
+
+    consumer.join();
+}
+
+// Test: The eventfd notifier makes the fd readable only when the consumer is armed
+TEST(SkylakeSPSCUnidirectionalRing, EventfdNotifier) {
+    using ring_t = skl::spsc_unidirectional_ring_t<u64, 64U, false, skl::ring_eventfd_notifier_t>;
+    auto ring    = std::make_unique<ring_t>();
+    ASSERT_EQ(ring->notifier().create(), SKL_SUCCESS);
+    ASSERT_EQ(ring->notifier().create(), SKL_ERR_STATE);
+    ASSERT_NE(ring->notifier().fd(), -1);
+
+    pollfd poll_fd{};
+    poll_fd.fd     = ring->notifier().fd();
+    poll_fd.events = POLLIN;
+
+    // Not armed, no syscall and no notification
+    ring->allocate_checked() = 1U;
+    ring->submit();
+    ASSERT_EQ(::poll(&poll_fd, 1U, 0), 0);
+
+    // Pending objects, do not wait
+    ASSERT_FALSE(ring->prepare_wait());
+
+    u64* burst[16U];
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 1U);
+    ring->free_processed();
+
+    // Armed, the submit makes the fd readable
+    ASSERT_TRUE(ring->prepare_wait());
+    ring->allocate_checked() = 2U;
+    ring->submit();
+    ASSERT_EQ(::poll(&poll_fd, 1U, 1000), 1);
+    ring->finish_wait();
+    ASSERT_EQ(::poll(&poll_fd, 1U, 0), 0);
+
+    ASSERT_EQ(ring->dequeue_burst(burst, 16U), 1U);
+    ASSERT_EQ(*burst[0U], 2U);
+}
@@ -1,9 +1,11 @@
 #include <skl_pool/stable_object_pool>
+#include <skl_core>
 
 #include <gtest/gtest.h>
 #include <vector>
 #include <random>
 #include <chrono>
+#include <algorithm>
 
 namespace {
 u64 g_constructed = 0u;
@@ -544,3 +546,127 @@ TEST(SkylakeStableObjectPool, performance_vs_new_delete) {
                std::chrono::duration_cast<std::chrono::nanoseconds>(new_time).count() / iterations);
     }
 }
+
+TEST(SkylakeStableObjectPool, blocks_are_aligned) {
+    pool_t pool{};
+
+    std::vector<Object*> objects;
+    for (u64 i = 0; i < CCapacity * 4u; ++i) {
+        objects.push_back(pool.allocate());
+        ASSERT_NE(objects.back(), nullptr);
+    }
+
+    // Every object masks back to its block, blocks are power of two aligned
+    static_assert((pool_t::CBlockAlignment & (pool_t::CBlockAlignment - 1u)) == 0u);
+    static_assert(pool_t::CBlockAlignment >= sizeof(pool_t::block_t));
+    for (auto* obj : objects) {
+        const auto* block = reinterpret_cast<const pool_t::block_t*>(reinterpret_cast<u64>(obj) & ~(pool_t::CBlockAlignment - 1u));
+        ASSERT_EQ(block->m_header.m_owner, &pool);
+        ASSERT_LT(block->m_header.m_index, 4u);
+        ASSERT_TRUE(block->m_pool.owns(obj));
+    }
+
+    // Addresses in a block but outside of the objects storage are not owned
+    const auto* first_block = reinterpret_cast<const pool_t::block_t*>(reinterpret_cast<u64>(objects[0]) & ~(pool_t::CBlockAlignment - 1u));
+    ASSERT_FALSE(pool.owns(reinterpret_cast<const Object*>(first_block)));
+
+    for (auto* obj : objects) {
+        ASSERT_TRUE(pool.deallocate_safe(obj));
+    }
+    ASSERT_TRUE(pool.empty());
+
+    pool.clear();
+    ASSERT_FALSE(pool.owns(objects[0]));
+}
+
+TEST(SkylakeStableObjectPool, mem_usage_counts_block_allocations) {
+    // Each block is one allocation of exactly sizeof(block_t) (aligned by the allocator, not over-allocated)
+    pool_t pool{};
+
+    std::vector<Object*> objects;
+    for (u64 i = 0; i < (CCapacity * 2u); ++i) {
+        objects.push_back(pool.allocate());
+    }
+
+    constexpr u64 CMetadataBound = 4096u;
+    ASSERT_GE(pool.mem_usage(), 2u * sizeof(pool_t::block_t));
+    ASSERT_LT(pool.mem_usage(), (2u * sizeof(pool_t::block_t)) + CMetadataBound);
+
+    for (auto* obj : objects) {
+        ASSERT_TRUE(pool.deallocate_safe(obj));
+    }
+}
+
+TEST(SkylakeStableObjectPool, huge_pages_mem_usage) {
+    // One huge page per block, or one 2MB aligned heap allocation of sizeof(block_t) without huge pages
+    using huge_pool_t = skl::StableObjectPool<Object, 0u, true, false, true>;
+    ASSERT_TRUE(skl::skl_core_init().is_success());
+
+    {
+        huge_pool_t pool{};
+        Object*     obj = pool.allocate();
+        ASSERT_NE(obj, nullptr);
+        ASSERT_TRUE(pool.owns(obj));
+
+        const u64 block_bytes = skl::huge_pages::is_huge_pages_enabled() ? skl::huge_pages::CHugePageSize : sizeof(huge_pool_t::block_t);
+        ASSERT_GE(pool.mem_usage(), block_bytes);
+        ASSERT_LT(pool.mem_usage(), block_bytes + 4096u);
+
+        ASSERT_TRUE(pool.deallocate_safe(obj));
+    }
+
+    ASSERT_TRUE(skl::skl_core_deinit().is_success());
+}
+
+// Deallocation cost must not depend on the number of blocks
+TEST(SkylakeStableObjectPool, performance_deallocate_10k_blocks) {
+    constexpr u64 CSmallBlock = 16u;
+    constexpr u64 CBlocks     = 10000u;
+    constexpr u64 CTotal      = CSmallBlock * CBlocks;
+
+    using small_pool_t = skl::StableObjectPool<Object, CSmallBlock>;
+
+    small_pool_t         pool{};
+    std::vector<Object*> objects;
+    objects.reserve(CTotal);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (u64 i = 0; i < CTotal; ++i) {
+        objects.push_back(pool.allocate());
+        ASSERT_NE(objects.back(), nullptr);
+    }
+    auto alloc_time = std::chrono::high_resolution_clock::now() - start;
+
+    ASSERT_EQ(pool.capacity(), CTotal);
+    ASSERT_EQ(pool.size(), CTotal);
+
+    std::mt19937 rng(42);
+    std::shuffle(objects.begin(), objects.end(), rng);
+
+    // owns() on every object
+    start = std::chrono::high_resolution_clock::now();
+    u64 owned = 0u;
+    for (auto* obj : objects) {
+        owned += pool.owns(obj) ? 1u : 0u;
+    }
+    auto owns_time = std::chrono::high_resolution_clock::now() - start;
+    ASSERT_EQ(owned, CTotal);
+
+    // Free half with deallocate(), half with deallocate_safe(), random block order
+    start = std::chrono::high_resolution_clock::now();
+    for (u64 i = 0; i < CTotal; i += 2u) {
+        pool.deallocate(objects[i]);
+    }
+    for (u64 i = 1; i < CTotal; i += 2u) {
+        ASSERT_TRUE(pool.deallocate_safe(objects[i]));
+    }
+    auto dealloc_time = std::chrono::high_resolution_clock::now() - start;
+
+    ASSERT_TRUE(pool.empty());
+
+    printf("%lu blocks: alloc %lld ns/op, owns %lld ns/op, dealloc %lld ns/op\n",
+           CBlocks,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(alloc_time).count() / CTotal,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(owns_time).count() / CTotal,
+           std::chrono::duration_cast<std::chrono::nanoseconds>(dealloc_time).count() / CTotal);
+}
@@ -0,0 +1,91 @@
+//!
+//! \file main.cpp
+//!
+//! \brief SLogger network sink collector: receives the raw serialized records and prints them formatted
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <cstdio>
+#include <cstdlib>
+
+#include <skl_core>
+#include <skl_signal>
+#include <skl_socket>
+#include <skl_logger/skl_slogger_net.hpp>
+
+namespace {
+constexpr u32 CCollectorPollTimeoutMs = 100U;
+
+void print_usage(const char* f_program) noexcept {
+    (void)printf("Usage: %s <port> [bind ipv4 address (default 0.0.0.0)] [--no-colors]\n", f_program);
+}
+} // namespace
+
+int main(int argc, const char** argv) {
+    if (argc < 2) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    const auto port = atoi(argv[1]);
+    if ((0 >= port) || (0xFFFF < port)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    skl::ipv4_addr_t address    = skl::CIpAny;
+    bool             use_colors = true;
+    for (int i = 2; i < argc; ++i) {
+        if (0 == __builtin_strcmp(argv[i], "--no-colors")) {
+            use_colors = false;
+            continue;
+        }
+
+        const auto parsed = skl::ipv4_addr_from_str_safe(argv[i]);
+        if (parsed.is_failure()) {
+            (void)printf("Invalid ipv4 address \"%s\"!\n", argv[i]);
+            return 1;
+        }
+        address = parsed.value();
+    }
+
+    if (skl::skl_core_init().is_failure()) {
+        (void)puts("Failed to init skylake core!");
+        return 1;
+    }
+
+    skl::SLoggerNetCollector collector{};
+    if (collector.open(address, skl::net_port_t(port)).is_failure()) {
+        (void)printf("Failed to bind the collector to port %d!\n", port);
+        (void)skl::skl_core_deinit();
+        return 1;
+    }
+
+    auto on_record = [](skl::skl_string_view f_text) noexcept {
+        (void)puts(f_text.data());
+    };
+
+    i32 exit_code = 0;
+    while (false == skl::exit_was_requested()) {
+        const auto result = use_colors ? collector.poll<true>(CCollectorPollTimeoutMs, on_record)
+                                       : collector.poll<false>(CCollectorPollTimeoutMs, on_record);
+        if (result.is_failure()) {
+            (void)puts("Failed to receive from the collector socket!");
+            exit_code = 1;
+            break;
+        }
+    }
+
+    const auto& stats = collector.stats();
+    (void)printf("[Collector] datagrams=%llu records=%llu bytes=%llu lost_datagrams=%llu malformed=%llu\n",
+                 static_cast<unsigned long long>(stats.m_datagrams_count),
+                 static_cast<unsigned long long>(stats.m_records_count),
+                 static_cast<unsigned long long>(stats.m_bytes_count),
+                 static_cast<unsigned long long>(stats.m_lost_datagrams_count),
+                 static_cast<unsigned long long>(stats.m_malformed_count));
+
+    collector.close();
+    (void)skl::skl_core_deinit();
+
+    return exit_code;
+}
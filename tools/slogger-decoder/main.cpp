@@ -0,0 +1,64 @@
+//!
+//! \file main.cpp
+//!
+//! \brief SLogger binary log file decoder: replays the binary records through the back-end and prints them formatted
+//!
+//! \license Licensed under the MIT License. See LICENSE for details.
+//!
+#include <cstdio>
+
+#include <skl_core>
+#include <skl_logger/skl_slogger_binary.hpp>
+
+namespace {
+void print_usage(const char* f_program) noexcept {
+    (void)printf("Usage: %s <binary log file> [--no-colors]\n", f_program);
+}
+} // namespace
+
+int main(int argc, const char** argv) {
+    if ((argc < 2) || (argc > 3)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    bool use_colors = true;
+    if (3 == argc) {
+        if (0 != __builtin_strcmp(argv[2], "--no-colors")) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        use_colors = false;
+    }
+
+    if (skl::skl_core_init().is_failure()) {
+        (void)puts("Failed to init skylake core!");
+        return 1;
+    }
+
+    skl::SLoggerBinaryDecoder decoder{};
+    if (decoder.open(argv[1]).is_failure()) {
+        (void)printf("Failed to open the binary log file \"%s\"!\n", argv[1]);
+        (void)skl::skl_core_deinit();
+        return 1;
+    }
+
+    auto on_record = [](skl::skl_string_view f_text) noexcept {
+        (void)puts(f_text.data());
+    };
+
+    const auto result = use_colors ? decoder.decode<true>(on_record) : decoder.decode<false>(on_record);
+
+    const auto& stats = decoder.stats();
+    (void)fprintf(stderr,
+                  "[Decoder] segments=%llu dictionary=%llu records=%llu malformed=%llu\n",
+                  static_cast<unsigned long long>(stats.m_segments_count),
+                  static_cast<unsigned long long>(stats.m_dictionary_count),
+                  static_cast<unsigned long long>(stats.m_records_count),
+                  static_cast<unsigned long long>(stats.m_malformed_count));
+
+    decoder.close();
+    (void)skl::skl_core_deinit();
+
+    return result.is_success() ? 0 : 1;
+}